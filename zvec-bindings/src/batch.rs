@@ -0,0 +1,224 @@
+use std::ffi::CString;
+use std::os::raw::{c_char, c_void};
+use std::ptr;
+
+use crate::error::{Error, Result};
+use crate::ffi;
+
+/// A batch of documents laid out column by column for bulk writes.
+///
+/// Rows are identified by their primary keys. The dense vector field is a
+/// row-major `count x dimension` matrix and every scalar field is one slice
+/// holding a value per row. Writing a batch with
+/// [`Collection::insert_columnar`](crate::Collection::insert_columnar) builds
+/// the documents directly from these buffers instead of going through a
+/// [`Doc`](crate::Doc) handle per row. The engine's documents own their
+/// values, so each vector row, primary key and string is still copied once
+/// into its document.
+///
+/// # Example
+///
+/// ```rust,no_run
+/// use zvec_bindings::{create_and_open, CollectionSchema, ColumnarBatch, FieldSchema, VectorSchema};
+///
+/// # fn main() -> zvec_bindings::Result<()> {
+/// let mut schema = CollectionSchema::new("my_collection");
+/// schema.add_field(VectorSchema::fp32("embedding", 2).into())?;
+/// schema.add_field(FieldSchema::int64("count"))?;
+/// let collection = create_and_open("./my_db", schema)?;
+///
+/// let vectors = [0.1, 0.2, 0.3, 0.4];
+/// let batch = ColumnarBatch::new(&["doc_1", "doc_2"])?
+///     .with_vector("embedding", &vectors, 2)?
+///     .with_int64("count", &[1, 2])?;
+/// collection.insert_columnar(&batch)?;
+/// # Ok(())
+/// # }
+/// ```
+pub struct ColumnarBatch<'a> {
+    pks: Vec<CString>,
+    pub(crate) pk_ptrs: Vec<*const c_char>,
+    vector_field: Option<CString>,
+    vectors: &'a [f32],
+    dimension: usize,
+    names: Vec<CString>,
+    strings: Vec<(Vec<CString>, Vec<*const c_char>)>,
+    pub(crate) columns: Vec<ffi::zvec_column_t>,
+}
+
+impl<'a> ColumnarBatch<'a> {
+    /// Create a batch with one row per primary key.
+    pub fn new<S: AsRef<str>>(pks: &[S]) -> Result<Self> {
+        let pks = pks
+            .iter()
+            .map(|pk| CString::new(pk.as_ref()))
+            .collect::<std::result::Result<Vec<_>, _>>()?;
+        let pk_ptrs = pks.iter().map(|pk| pk.as_ptr()).collect();
+        Ok(Self {
+            pks,
+            pk_ptrs,
+            vector_field: None,
+            vectors: &[],
+            dimension: 0,
+            names: Vec::new(),
+            strings: Vec::new(),
+            columns: Vec::new(),
+        })
+    }
+
+    /// Number of rows in the batch.
+    pub fn len(&self) -> usize {
+        self.pks.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.pks.is_empty()
+    }
+
+    /// Set the dense fp32 vector field from a row-major `len() x dimension` matrix.
+    pub fn with_vector(
+        mut self,
+        field: &str,
+        vectors: &'a [f32],
+        dimension: usize,
+    ) -> Result<Self> {
+        if dimension == 0 || vectors.len() != self.len() * dimension {
+            return Err(Error::DimensionMismatch {
+                expected: self.len() * dimension,
+                actual: vectors.len(),
+            });
+        }
+        self.vector_field = Some(CString::new(field)?);
+        self.vectors = vectors;
+        self.dimension = dimension;
+        Ok(self)
+    }
+
+    pub fn with_bool(self, field: &str, values: &'a [bool]) -> Result<Self> {
+        self.with_column(field, ffi::zvec_data_type_ZVEC_DATA_TYPE_BOOL, values)
+    }
+
+    pub fn with_int32(self, field: &str, values: &'a [i32]) -> Result<Self> {
+        self.with_column(field, ffi::zvec_data_type_ZVEC_DATA_TYPE_INT32, values)
+    }
+
+    pub fn with_int64(self, field: &str, values: &'a [i64]) -> Result<Self> {
+        self.with_column(field, ffi::zvec_data_type_ZVEC_DATA_TYPE_INT64, values)
+    }
+
+    pub fn with_uint32(self, field: &str, values: &'a [u32]) -> Result<Self> {
+        self.with_column(field, ffi::zvec_data_type_ZVEC_DATA_TYPE_UINT32, values)
+    }
+
+    pub fn with_uint64(self, field: &str, values: &'a [u64]) -> Result<Self> {
+        self.with_column(field, ffi::zvec_data_type_ZVEC_DATA_TYPE_UINT64, values)
+    }
+
+    pub fn with_float(self, field: &str, values: &'a [f32]) -> Result<Self> {
+        self.with_column(field, ffi::zvec_data_type_ZVEC_DATA_TYPE_FLOAT, values)
+    }
+
+    pub fn with_double(self, field: &str, values: &'a [f64]) -> Result<Self> {
+        self.with_column(field, ffi::zvec_data_type_ZVEC_DATA_TYPE_DOUBLE, values)
+    }
+
+    pub fn with_string<S: AsRef<str>>(self, field: &str, values: &[S]) -> Result<Self> {
+        self.check_len(values.len())?;
+        self.with_strings(field, values.iter().map(|v| Some(v.as_ref())))
+    }
+
+    /// Set a string field where `None` entries are stored as null.
+    pub fn with_nullable_string<S: AsRef<str>>(
+        self,
+        field: &str,
+        values: &[Option<S>],
+    ) -> Result<Self> {
+        self.check_len(values.len())?;
+        self.with_strings(field, values.iter().map(|v| v.as_ref().map(|s| s.as_ref())))
+    }
+
+    pub(crate) fn vector_field_ptr(&self) -> *const c_char {
+        self.vector_field
+            .as_ref()
+            .map(|f| f.as_ptr())
+            .unwrap_or(ptr::null())
+    }
+
+    pub(crate) fn vectors_ptr(&self) -> *const f32 {
+        if self.vector_field.is_some() {
+            self.vectors.as_ptr()
+        } else {
+            ptr::null()
+        }
+    }
+
+    pub(crate) fn dimension(&self) -> usize {
+        self.dimension
+    }
+
+    fn with_column<T>(
+        mut self,
+        field: &str,
+        data_type: ffi::zvec_data_type_t,
+        values: &'a [T],
+    ) -> Result<Self> {
+        self.check_len(values.len())?;
+        self.push_column(field, data_type, values.as_ptr() as *const c_void)?;
+        Ok(self)
+    }
+
+    fn with_strings<'s>(
+        mut self,
+        field: &str,
+        values: impl Iterator<Item = Option<&'s str>>,
+    ) -> Result<Self> {
+        let mut owned = Vec::with_capacity(self.len());
+        let mut ptrs = Vec::with_capacity(self.len());
+        for value in values {
+            match value {
+                Some(s) => {
+                    let s = CString::new(s)?;
+                    ptrs.push(s.as_ptr());
+                    owned.push(s);
+                }
+                None => ptrs.push(ptr::null()),
+            }
+        }
+        let data = ptrs.as_ptr() as *const c_void;
+        self.strings.push((owned, ptrs));
+        self.push_column(field, ffi::zvec_data_type_ZVEC_DATA_TYPE_STRING, data)?;
+        Ok(self)
+    }
+
+    fn check_len(&self, len: usize) -> Result<()> {
+        if len != self.len() {
+            return Err(Error::InvalidArgument(format!(
+                "column has {} values, batch has {} rows",
+                len,
+                self.len()
+            )));
+        }
+        Ok(())
+    }
+
+    fn push_column(
+        &mut self,
+        field: &str,
+        data_type: ffi::zvec_data_type_t,
+        data: *const c_void,
+    ) -> Result<()> {
+        let name = CString::new(field)?;
+        self.columns.push(ffi::zvec_column_t {
+            name: name.as_ptr(),
+            data_type,
+            data,
+        });
+        self.names.push(name);
+        Ok(())
+    }
+}
+
+// SAFETY: All pointers held by the batch point into buffers it owns or borrows
+// immutably for 'a; nothing is shared mutably.
+unsafe impl Send for ColumnarBatch<'_> {}
+unsafe impl Sync for ColumnarBatch<'_> {}
@@ -0,0 +1,75 @@
+use std::marker::PhantomData;
+
+use crate::collection::Collection;
+use crate::doc::{Doc, WriteSummary};
+use crate::error::{check_status, Result};
+use crate::ffi;
+
+/// Streams documents into a collection in batches.
+///
+/// Documents passed to [`add`](BulkWriter::add) are buffered until a full batch
+/// has accumulated; that batch is then written on a background thread while the
+/// next one fills, so building documents and writing them overlap.
+/// [`finish`](BulkWriter::finish) writes what is left, flushes the collection
+/// and reports the outcome of every added document.
+///
+/// Dropping a writer without finishing it discards the partially filled batch.
+///
+/// # Example
+///
+/// ```rust,no_run
+/// use zvec_bindings::{create_and_open, CollectionSchema, Doc, Operator, VectorSchema};
+///
+/// # fn main() -> zvec_bindings::Result<()> {
+/// let mut schema = CollectionSchema::new("my_collection");
+/// schema.add_field(VectorSchema::fp32("embedding", 2).into())?;
+/// let collection = create_and_open("./my_db", schema)?;
+///
+/// let mut writer = collection.bulk_writer(Operator::Upsert, 1000)?;
+/// for i in 0..10_000 {
+///     writer.add(&Doc::id(format!("doc_{}", i)).with_vector("embedding", &[0.1, 0.2])?)?;
+/// }
+/// let summary = writer.finish()?;
+/// assert!(summary.all_ok());
+/// # Ok(())
+/// # }
+/// ```
+pub struct BulkWriter<'a> {
+    pub(crate) ptr: *mut ffi::zvec_bulk_writer_t,
+    pub(crate) _marker: PhantomData<&'a Collection>,
+}
+
+impl BulkWriter<'_> {
+    /// Add one document. The document is copied into the writer.
+    pub fn add(&mut self, doc: &Doc) -> Result<()> {
+        self.add_all(std::slice::from_ref(doc))
+    }
+
+    /// Add several documents. The documents are copied into the writer.
+    pub fn add_all(&mut self, docs: &[Doc]) -> Result<()> {
+        let mut doc_ptrs: Vec<*mut ffi::zvec_doc_t> = docs.iter().map(|d| d.ptr).collect();
+        let status =
+            unsafe { ffi::zvec_bulk_writer_add(self.ptr, doc_ptrs.as_mut_ptr(), doc_ptrs.len()) };
+        check_status(status)
+    }
+
+    /// Write the remaining documents, wait for the background writes and flush.
+    pub fn finish(self) -> Result<WriteSummary> {
+        let mut summary: ffi::zvec_write_summary_t = unsafe { std::mem::zeroed() };
+        let status = unsafe { ffi::zvec_bulk_writer_finish(self.ptr, &mut summary) };
+        let summary = WriteSummary { inner: summary };
+        check_status(status)?;
+        Ok(summary)
+    }
+}
+
+impl Drop for BulkWriter<'_> {
+    fn drop(&mut self) {
+        if !self.ptr.is_null() {
+            unsafe { ffi::zvec_bulk_writer_free(self.ptr) };
+        }
+    }
+}
+
+// SAFETY: The writer owns its C handle; the background thread is internal to it.
+unsafe impl Send for BulkWriter<'_> {}
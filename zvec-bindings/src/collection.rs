@@ -1,13 +1,23 @@
 use std::ffi::CString;
+use std::future::Future;
+use std::os::raw::c_void;
 use std::path::Path;
+use std::pin::Pin;
 use std::ptr;
+use std::sync::{Arc, Mutex, PoisonError};
+use std::task::{Context, Poll, Waker};
 
-use crate::doc::{Doc, DocList, DocMap, WriteResults};
+use crate::batch::ColumnarBatch;
+use crate::bulk::BulkWriter;
+use crate::doc::{Doc, DocList, DocMap, WriteResults, WriteSummary};
 use crate::error::{check_status, Result};
 use crate::ffi;
-use crate::query::{GroupByVectorQuery, GroupResults, VectorQuery};
+use crate::query::{
+    FlatResults, GroupByVectorQuery, GroupResults, PreparedQuery, SearchIterator, VectorQuery,
+};
+use crate::rerank::{RrfReRanker, WeightedReRanker};
 use crate::schema::{CollectionSchema, FieldSchema};
-use crate::types::{IndexType, MetricType, QuantizeType};
+use crate::types::{DataType, IndexType, MetricType, Operator, QuantizeType};
 
 pub struct CollectionStats {
     pub doc_count: u64,
@@ -62,17 +72,29 @@ pub struct Collection {
 
 impl Collection {
     pub fn create_and_open<P: AsRef<Path>>(path: P, schema: CollectionSchema) -> Result<Self> {
+        Self::create_and_open_raw(path, schema, ptr::null_mut())
+    }
+
+    /// Create and open a new collection with the given [`CollectionOptions`].
+    pub fn create_and_open_with_options<P: AsRef<Path>>(
+        path: P,
+        schema: CollectionSchema,
+        options: &CollectionOptions,
+    ) -> Result<Self> {
+        Self::create_and_open_raw(path, schema, options.ptr)
+    }
+
+    fn create_and_open_raw<P: AsRef<Path>>(
+        path: P,
+        schema: CollectionSchema,
+        options: *mut ffi::zvec_collection_options_t,
+    ) -> Result<Self> {
         let path_str = path.as_ref().to_string_lossy().into_owned();
         let path_c = CString::new(path_str).unwrap();
 
         let mut status: ffi::zvec_status_t = unsafe { std::mem::zeroed() };
         let ptr = unsafe {
-            ffi::zvec_collection_create_and_open(
-                path_c.as_ptr(),
-                schema.ptr,
-                ptr::null_mut(),
-                &mut status,
-            )
+            ffi::zvec_collection_create_and_open(path_c.as_ptr(), schema.ptr, options, &mut status)
         };
 
         check_status(status)?;
@@ -87,12 +109,23 @@ impl Collection {
     }
 
     pub fn open<P: AsRef<Path>>(path: P) -> Result<Self> {
+        Self::open_raw(path, ptr::null_mut())
+    }
+
+    /// Open an existing collection with the given [`CollectionOptions`].
+    pub fn open_with_options<P: AsRef<Path>>(path: P, options: &CollectionOptions) -> Result<Self> {
+        Self::open_raw(path, options.ptr)
+    }
+
+    fn open_raw<P: AsRef<Path>>(
+        path: P,
+        options: *mut ffi::zvec_collection_options_t,
+    ) -> Result<Self> {
         let path_str = path.as_ref().to_string_lossy().into_owned();
         let path_c = CString::new(path_str).unwrap();
 
         let mut status: ffi::zvec_status_t = unsafe { std::mem::zeroed() };
-        let ptr =
-            unsafe { ffi::zvec_collection_open(path_c.as_ptr(), ptr::null_mut(), &mut status) };
+        let ptr = unsafe { ffi::zvec_collection_open(path_c.as_ptr(), options, &mut status) };
 
         check_status(status)?;
 
@@ -183,6 +216,127 @@ impl Collection {
         Ok(WriteResults { inner: results })
     }
 
+    /// Insert documents, taking ownership of them.
+    ///
+    /// Like [`Collection::insert`], but the document contents are moved into
+    /// the write instead of copied.
+    pub fn insert_owned(&self, docs: Vec<Doc>) -> Result<WriteResults> {
+        let mut doc_ptrs: Vec<*mut ffi::zvec_doc_t> = docs
+            .into_iter()
+            .map(|mut d| std::mem::replace(&mut d.ptr, ptr::null_mut()))
+            .collect();
+        let mut results: ffi::zvec_write_results_t = unsafe { std::mem::zeroed() };
+
+        let status = unsafe {
+            ffi::zvec_collection_insert_consume(
+                self.ptr,
+                doc_ptrs.as_mut_ptr(),
+                doc_ptrs.len(),
+                &mut results,
+            )
+        };
+
+        check_status(status)?;
+        Ok(WriteResults { inner: results })
+    }
+
+    /// Upsert documents, taking ownership of them.
+    ///
+    /// Like [`Collection::upsert`], but the document contents are moved into
+    /// the write instead of copied.
+    pub fn upsert_owned(&self, docs: Vec<Doc>) -> Result<WriteResults> {
+        let mut doc_ptrs: Vec<*mut ffi::zvec_doc_t> = docs
+            .into_iter()
+            .map(|mut d| std::mem::replace(&mut d.ptr, ptr::null_mut()))
+            .collect();
+        let mut results: ffi::zvec_write_results_t = unsafe { std::mem::zeroed() };
+
+        let status = unsafe {
+            ffi::zvec_collection_upsert_consume(
+                self.ptr,
+                doc_ptrs.as_mut_ptr(),
+                doc_ptrs.len(),
+                &mut results,
+            )
+        };
+
+        check_status(status)?;
+        Ok(WriteResults { inner: results })
+    }
+
+    /// Update documents, taking ownership of them.
+    ///
+    /// Like [`Collection::update`], but the document contents are moved into
+    /// the write instead of copied.
+    pub fn update_owned(&self, docs: Vec<Doc>) -> Result<WriteResults> {
+        let mut doc_ptrs: Vec<*mut ffi::zvec_doc_t> = docs
+            .into_iter()
+            .map(|mut d| std::mem::replace(&mut d.ptr, ptr::null_mut()))
+            .collect();
+        let mut results: ffi::zvec_write_results_t = unsafe { std::mem::zeroed() };
+
+        let status = unsafe {
+            ffi::zvec_collection_update_consume(
+                self.ptr,
+                doc_ptrs.as_mut_ptr(),
+                doc_ptrs.len(),
+                &mut results,
+            )
+        };
+
+        check_status(status)?;
+        Ok(WriteResults { inner: results })
+    }
+
+    /// Insert a columnar batch of documents.
+    ///
+    /// Documents are built directly from the batch's buffers, skipping the
+    /// per-row [`Doc`] handle and its extra copy of the vector.
+    pub fn insert_columnar(&self, batch: &ColumnarBatch<'_>) -> Result<WriteResults> {
+        let mut results: ffi::zvec_write_results_t = unsafe { std::mem::zeroed() };
+
+        let status = unsafe {
+            ffi::zvec_collection_insert_columnar(
+                self.ptr,
+                batch.pk_ptrs.as_ptr() as *mut _,
+                batch.len(),
+                batch.vector_field_ptr(),
+                batch.vectors_ptr(),
+                batch.dimension(),
+                batch.columns.as_ptr(),
+                batch.columns.len(),
+                &mut results,
+            )
+        };
+
+        check_status(status)?;
+        Ok(WriteResults { inner: results })
+    }
+
+    /// Upsert a columnar batch of documents.
+    ///
+    /// See [`Collection::insert_columnar`].
+    pub fn upsert_columnar(&self, batch: &ColumnarBatch<'_>) -> Result<WriteResults> {
+        let mut results: ffi::zvec_write_results_t = unsafe { std::mem::zeroed() };
+
+        let status = unsafe {
+            ffi::zvec_collection_upsert_columnar(
+                self.ptr,
+                batch.pk_ptrs.as_ptr() as *mut _,
+                batch.len(),
+                batch.vector_field_ptr(),
+                batch.vectors_ptr(),
+                batch.dimension(),
+                batch.columns.as_ptr(),
+                batch.columns.len(),
+                &mut results,
+            )
+        };
+
+        check_status(status)?;
+        Ok(WriteResults { inner: results })
+    }
+
     /// Delete documents by primary key.
     pub fn delete(&self, pks: &[&str]) -> Result<WriteResults> {
         let pk_cstrings: Vec<CString> = pks.iter().map(|pk| CString::new(*pk).unwrap()).collect();
@@ -198,6 +352,125 @@ impl Collection {
         Ok(WriteResults { inner: results })
     }
 
+    /// Insert documents, reporting the outcome as a [`WriteSummary`].
+    ///
+    /// Unlike [`Collection::insert`], no per-document status is allocated;
+    /// a batch in which every document succeeds returns just the counts.
+    pub fn insert_summary(&self, docs: &[Doc]) -> Result<WriteSummary> {
+        self.write_summary(ffi::zvec_operator_ZVEC_OPERATOR_INSERT, docs)
+    }
+
+    /// Upsert documents, reporting the outcome as a [`WriteSummary`].
+    pub fn upsert_summary(&self, docs: &[Doc]) -> Result<WriteSummary> {
+        self.write_summary(ffi::zvec_operator_ZVEC_OPERATOR_UPSERT, docs)
+    }
+
+    /// Update documents, reporting the outcome as a [`WriteSummary`].
+    pub fn update_summary(&self, docs: &[Doc]) -> Result<WriteSummary> {
+        self.write_summary(ffi::zvec_operator_ZVEC_OPERATOR_UPDATE, docs)
+    }
+
+    /// Delete documents by primary key, reporting the outcome as a [`WriteSummary`].
+    pub fn delete_summary(&self, pks: &[&str]) -> Result<WriteSummary> {
+        let pk_cstrings = pks
+            .iter()
+            .map(|pk| CString::new(*pk))
+            .collect::<std::result::Result<Vec<_>, _>>()?;
+        let mut pk_ptrs: Vec<*const std::os::raw::c_char> =
+            pk_cstrings.iter().map(|pk| pk.as_ptr()).collect();
+        let mut summary: ffi::zvec_write_summary_t = unsafe { std::mem::zeroed() };
+
+        let status = unsafe {
+            ffi::zvec_collection_delete_summary(
+                self.ptr,
+                pk_ptrs.as_mut_ptr(),
+                pk_ptrs.len(),
+                &mut summary,
+            )
+        };
+
+        check_status(status)?;
+        Ok(WriteSummary { inner: summary })
+    }
+
+    fn write_summary(&self, op: ffi::zvec_operator_t, docs: &[Doc]) -> Result<WriteSummary> {
+        let mut doc_ptrs: Vec<*mut ffi::zvec_doc_t> = docs.iter().map(|d| d.ptr).collect();
+        let mut summary: ffi::zvec_write_summary_t = unsafe { std::mem::zeroed() };
+
+        let status = unsafe {
+            ffi::zvec_collection_write_summary(
+                self.ptr,
+                op,
+                doc_ptrs.as_mut_ptr(),
+                doc_ptrs.len(),
+                &mut summary,
+            )
+        };
+
+        check_status(status)?;
+        Ok(WriteSummary { inner: summary })
+    }
+
+    /// Queue an insert and return a future that resolves when it completes.
+    ///
+    /// The documents are copied before this returns. Queued writes run one at
+    /// a time, in submission order, on a background thread, so awaiting the
+    /// future does not block the calling thread.
+    pub fn insert_async(&self, docs: &[Doc]) -> WriteFuture {
+        self.write_async(ffi::zvec_collection_insert_async, docs)
+    }
+
+    /// Queue an upsert and return a future that resolves when it completes.
+    ///
+    /// See [`Collection::insert_async`].
+    pub fn upsert_async(&self, docs: &[Doc]) -> WriteFuture {
+        self.write_async(ffi::zvec_collection_upsert_async, docs)
+    }
+
+    fn write_async(&self, submit: AsyncWriteFn, docs: &[Doc]) -> WriteFuture {
+        let mut doc_ptrs: Vec<*mut ffi::zvec_doc_t> = docs.iter().map(|d| d.ptr).collect();
+        let state = Arc::new(Mutex::new(AsyncWriteState {
+            result: None,
+            waker: None,
+        }));
+        let user_data = Arc::into_raw(state.clone()) as *mut c_void;
+        let mut ticket = 0;
+
+        let status = unsafe {
+            submit(
+                self.ptr,
+                doc_ptrs.as_mut_ptr(),
+                doc_ptrs.len(),
+                Some(async_write_callback),
+                user_data,
+                &mut ticket,
+            )
+        };
+
+        if let Err(e) = check_status(status) {
+            // The callback will not run, so reclaim its reference here.
+            drop(unsafe { Arc::from_raw(user_data as *const Mutex<AsyncWriteState>) });
+            state.lock().unwrap_or_else(PoisonError::into_inner).result = Some(Err(e));
+        }
+        WriteFuture { state, ticket }
+    }
+
+    /// Open a [`BulkWriter`] that streams documents into this collection.
+    ///
+    /// `op` must be [`Operator::Insert`], [`Operator::Upsert`] or
+    /// [`Operator::Update`]. Documents are written in batches of `batch_size`
+    /// on a background thread.
+    pub fn bulk_writer(&self, op: Operator, batch_size: usize) -> Result<BulkWriter<'_>> {
+        let mut writer: *mut ffi::zvec_bulk_writer_t = ptr::null_mut();
+        let status =
+            unsafe { ffi::zvec_bulk_writer_open(self.ptr, op.into(), batch_size, &mut writer) };
+        check_status(status)?;
+        Ok(BulkWriter {
+            ptr: writer,
+            _marker: std::marker::PhantomData,
+        })
+    }
+
     /// Delete documents matching a filter expression.
     pub fn delete_by_filter(&self, filter: &str) -> Result<()> {
         let filter_c = CString::new(filter).unwrap();
@@ -215,6 +488,221 @@ impl Collection {
         Ok(DocList { inner: results })
     }
 
+    /// Validate a query against this collection's schema for repeated use.
+    ///
+    /// Fails if the vector field or any output field does not exist. Swap the
+    /// vector with [`PreparedQuery::set_vector`] and run the query with
+    /// [`query_prepared`](Collection::query_prepared).
+    pub fn prepare(&self, query: VectorQuery) -> Result<PreparedQuery> {
+        let mut dimension = 0;
+        let status =
+            unsafe { ffi::zvec_collection_prepare_query(self.ptr, query.ptr, &mut dimension) };
+        check_status(status)?;
+        Ok(PreparedQuery { query, dimension })
+    }
+
+    /// Execute a query prepared with [`prepare`](Collection::prepare).
+    pub fn query_prepared(&self, query: &PreparedQuery) -> Result<DocList> {
+        let mut results: ffi::zvec_doc_list_t = unsafe { std::mem::zeroed() };
+        let status = unsafe { ffi::zvec_collection_query(self.ptr, query.query.ptr, &mut results) };
+        check_status(status)?;
+        Ok(DocList { inner: results })
+    }
+
+    /// Execute a vector similarity search, returning hits as flat arrays.
+    ///
+    /// Avoids a document handle per hit, which matters for large `topk`.
+    /// `columns` names the scalar fields to extract along with their types;
+    /// only bool and numeric fields are supported, and they should be among
+    /// the query's output fields.
+    pub fn query_flat(
+        &self,
+        query: VectorQuery,
+        columns: &[(&str, DataType)],
+    ) -> Result<FlatResults> {
+        let names = columns
+            .iter()
+            .map(|(name, _)| CString::new(*name))
+            .collect::<std::result::Result<Vec<_>, _>>()?;
+        let mut name_ptrs: Vec<*const std::os::raw::c_char> =
+            names.iter().map(|n| n.as_ptr()).collect();
+        let types: Vec<ffi::zvec_data_type_t> = columns.iter().map(|(_, t)| (*t).into()).collect();
+        let mut results: ffi::zvec_flat_results_t = unsafe { std::mem::zeroed() };
+        let status = unsafe {
+            ffi::zvec_collection_query_flat(
+                self.ptr,
+                query.ptr,
+                name_ptrs.as_mut_ptr(),
+                types.as_ptr(),
+                columns.len(),
+                &mut results,
+            )
+        };
+        check_status(status)?;
+        Ok(FlatResults { inner: results })
+    }
+
+    /// Execute one query per row of a row-major query matrix.
+    ///
+    /// `query` supplies every setting except the vector, and each row runs
+    /// as [`query`](Collection::query) would, range and rerank modes
+    /// included. `vectors` holds `vectors.len() / dimension` query vectors
+    /// back to back; `dimension` must be the vector field's, and a `query`
+    /// set by pk or doc id is rejected. Queries run
+    /// concurrently (see [`set_thread_pool_size`](crate::set_thread_pool_size))
+    /// and results are returned in row order.
+    pub fn query_batch(
+        &self,
+        query: &VectorQuery,
+        vectors: &[f32],
+        dimension: usize,
+    ) -> Result<Vec<DocList>> {
+        self.query_batch_bounded(query, vectors, dimension)
+            .map(|(lists, _)| lists)
+    }
+
+    /// Like [`query_batch`](Collection::query_batch), also reporting whether
+    /// the template's timeout or cancel token stopped the batch early.
+    ///
+    /// Rows not started by then have empty results.
+    pub fn query_batch_bounded(
+        &self,
+        query: &VectorQuery,
+        vectors: &[f32],
+        dimension: usize,
+    ) -> Result<(Vec<DocList>, bool)> {
+        let count = vectors.len().checked_div(dimension).unwrap_or(0);
+        if count == 0 || count * dimension != vectors.len() {
+            return Err(crate::error::Error::InvalidArgument(
+                "vectors length must be a non-zero multiple of dimension".into(),
+            ));
+        }
+        let mut lists: Vec<ffi::zvec_doc_list_t> = vec![unsafe { std::mem::zeroed() }; count];
+        let mut truncated = false;
+        let status = unsafe {
+            ffi::zvec_collection_query_batch(
+                self.ptr,
+                query.ptr,
+                vectors.as_ptr(),
+                count,
+                dimension,
+                lists.as_mut_ptr(),
+                &mut truncated,
+            )
+        };
+        check_status(status)?;
+        let lists = lists.into_iter().map(|inner| DocList { inner }).collect();
+        Ok((lists, truncated))
+    }
+
+    /// Execute a vector similarity search within the query's
+    /// [`timeout`](VectorQuery::timeout) and
+    /// [`cancel_token`](VectorQuery::cancel_token).
+    ///
+    /// Returns the hits and whether the query was cut off. A cut-off query
+    /// has no hits. The budget bounds the wait, not the work: the engine
+    /// search cannot be interrupted, so it keeps a worker of a fixed pool,
+    /// and the CPU, until it finishes, and its result is discarded. While
+    /// four searches per worker are queued or running, new ones are refused
+    /// and reported as cut off.
+    pub fn query_bounded(&self, query: VectorQuery) -> Result<(DocList, bool)> {
+        let mut results: ffi::zvec_doc_list_t = unsafe { std::mem::zeroed() };
+        let mut truncated = false;
+        let status = unsafe {
+            ffi::zvec_collection_query_bounded(self.ptr, query.ptr, &mut results, &mut truncated)
+        };
+        check_status(status)?;
+        Ok((DocList { inner: results }, truncated))
+    }
+
+    /// Run several queries (e.g. over a dense and a sparse field) concurrently
+    /// and fuse their hits by Reciprocal Rank Fusion.
+    ///
+    /// Fusion happens inside the wrapper on internal doc ids, so it matches
+    /// [`RrfReRanker::rerank`] over the individual results without building
+    /// per-query pk lists. Each returned doc's score is its fused score.
+    pub fn hybrid_query_rrf(
+        &self,
+        queries: &[VectorQuery],
+        reranker: &RrfReRanker,
+    ) -> Result<DocList> {
+        let fusion = ffi::zvec_fusion_params_t {
+            kind: ffi::zvec_fusion_type_ZVEC_FUSION_RRF,
+            topn: reranker.topn(),
+            rank_constant: reranker.rank_constant(),
+            weights: ptr::null(),
+        };
+        self.hybrid_query(queries, &fusion)
+    }
+
+    /// Run several queries concurrently and fuse their hits by weighted,
+    /// metric-normalized score, as [`WeightedReRanker::rerank`] does. Each
+    /// query is weighted by the reranker's weight for its field.
+    ///
+    /// Unlike [`WeightedReRanker::rerank`], each query's scores are
+    /// normalized for the metric of its own field's index, read from the
+    /// schema; the reranker's metric is not used.
+    pub fn hybrid_query_weighted(
+        &self,
+        queries: &[VectorQuery],
+        reranker: &WeightedReRanker,
+    ) -> Result<DocList> {
+        let weights: Vec<f64> = queries
+            .iter()
+            .map(|query| reranker.weight(query.field_name()))
+            .collect();
+        let fusion = ffi::zvec_fusion_params_t {
+            kind: ffi::zvec_fusion_type_ZVEC_FUSION_WEIGHTED,
+            topn: reranker.topn(),
+            rank_constant: 0,
+            weights: weights.as_ptr(),
+        };
+        self.hybrid_query(queries, &fusion)
+    }
+
+    fn hybrid_query(
+        &self,
+        queries: &[VectorQuery],
+        fusion: &ffi::zvec_fusion_params_t,
+    ) -> Result<DocList> {
+        let mut query_ptrs: Vec<*mut ffi::zvec_vector_query_t> =
+            queries.iter().map(|query| query.ptr).collect();
+        let mut results: ffi::zvec_doc_list_t = unsafe { std::mem::zeroed() };
+        let status = unsafe {
+            ffi::zvec_collection_hybrid_query(
+                self.ptr,
+                query_ptrs.as_mut_ptr(),
+                query_ptrs.len(),
+                fusion,
+                &mut results,
+            )
+        };
+        check_status(status)?;
+        Ok(DocList { inner: results })
+    }
+
+    /// Page through the hits of `query`, `page_size` at a time.
+    ///
+    /// The query's `topk` is ignored; the iterator runs until the collection
+    /// has no further hits. See [`SearchIterator`].
+    pub fn search_iter(&self, query: &VectorQuery, page_size: usize) -> Result<SearchIterator<'_>> {
+        if page_size == 0 {
+            return Err(crate::error::Error::InvalidArgument(
+                "page_size must be positive".into(),
+            ));
+        }
+        let mut status: ffi::zvec_status_t = unsafe { std::mem::zeroed() };
+        let ptr =
+            unsafe { ffi::zvec_collection_search_iterator_new(self.ptr, query.ptr, &mut status) };
+        check_status(status)?;
+        Ok(SearchIterator {
+            ptr,
+            page_size,
+            finished: false,
+            _marker: std::marker::PhantomData,
+        })
+    }
+
     /// Execute a grouped vector similarity search query.
     ///
     /// Groups results by a specified field value.
@@ -243,6 +731,70 @@ impl Collection {
         Ok(DocMap { inner: results })
     }
 
+    /// Fetch the fp32 vector `field` of each document into `out`, a row-major
+    /// `pks.len()` x `dimension` matrix, in the order of `pks`.
+    ///
+    /// Avoids a document handle and map entry per pk, and `out` can be reused
+    /// across calls. Returns whether each row was filled; rows of missing
+    /// documents, or of vectors with another dimension, are zeroed.
+    pub fn fetch_vectors_into(
+        &self,
+        pks: &[&str],
+        field: &str,
+        dimension: usize,
+        out: &mut [f32],
+    ) -> Result<Vec<bool>> {
+        let pk_cstrings = pks
+            .iter()
+            .map(|pk| CString::new(*pk))
+            .collect::<std::result::Result<Vec<_>, _>>()?;
+        let mut pk_ptrs: Vec<*const std::os::raw::c_char> =
+            pk_cstrings.iter().map(|pk| pk.as_ptr()).collect();
+        self.fetch_vectors_raw(
+            pks.len(),
+            field,
+            dimension,
+            out,
+            |field, out, found| unsafe {
+                ffi::zvec_collection_fetch_vectors(
+                    self.ptr,
+                    pk_ptrs.as_mut_ptr(),
+                    pk_ptrs.len(),
+                    field,
+                    out,
+                    dimension,
+                    found,
+                )
+            },
+        )
+    }
+
+    fn fetch_vectors_raw(
+        &self,
+        count: usize,
+        field: &str,
+        dimension: usize,
+        out: &mut [f32],
+        fetch: impl FnOnce(*const std::os::raw::c_char, *mut f32, *mut u8) -> ffi::zvec_status_t,
+    ) -> Result<Vec<bool>> {
+        if count == 0 || dimension == 0 || out.len() != count * dimension {
+            return Err(crate::error::Error::InvalidArgument(
+                "out must hold one row of dimension floats per document".into(),
+            ));
+        }
+        let field_c = CString::new(field)?;
+        // At least (count + 7) / 8 bytes; div_ceil is newer than the MSRV.
+        let mut found = vec![0u8; count / 8 + 1];
+        check_status(fetch(
+            field_c.as_ptr(),
+            out.as_mut_ptr(),
+            found.as_mut_ptr(),
+        ))?;
+        Ok((0..count)
+            .map(|i| found[i / 8] & (1 << (i % 8)) != 0)
+            .collect())
+    }
+
     /// Create an index on a vector field.
     ///
     /// # Arguments
@@ -508,6 +1060,16 @@ impl CollectionOptions {
         unsafe { ffi::zvec_collection_options_set_enable_mmap(self.ptr, enable) };
         self
     }
+
+    /// Cache up to `capacity` query results for the opened handle, so a
+    /// repeated identical query skips the search. Any write through the handle
+    /// invalidates every cached result; writes through other handles or
+    /// processes are not seen, so leave the cache off on a handle whose
+    /// collection is written elsewhere. 0 (the default) disables the cache.
+    pub fn result_cache_capacity(self, capacity: usize) -> Self {
+        unsafe { ffi::zvec_collection_options_set_result_cache_capacity(self.ptr, capacity) };
+        self
+    }
 }
 
 impl Default for CollectionOptions {
@@ -524,6 +1086,75 @@ impl Drop for CollectionOptions {
     }
 }
 
+type AsyncWriteFn = unsafe extern "C" fn(
+    *mut ffi::zvec_collection_t,
+    *mut *mut ffi::zvec_doc_t,
+    usize,
+    ffi::zvec_write_callback_t,
+    *mut c_void,
+    *mut u64,
+) -> ffi::zvec_status_t;
+
+struct AsyncWriteState {
+    result: Option<Result<WriteResults>>,
+    waker: Option<Waker>,
+}
+
+/// Future returned by [`Collection::insert_async`] and
+/// [`Collection::upsert_async`].
+///
+/// The write has already been queued when the future is created; dropping the
+/// future does not cancel it. Works with any executor.
+pub struct WriteFuture {
+    state: Arc<Mutex<AsyncWriteState>>,
+    ticket: u64,
+}
+
+impl WriteFuture {
+    /// Id assigned to the write when it was queued, or 0 if queueing failed.
+    pub fn ticket(&self) -> u64 {
+        self.ticket
+    }
+}
+
+impl Future for WriteFuture {
+    type Output = Result<WriteResults>;
+
+    fn poll(self: Pin<&mut Self>, cx: &mut Context<'_>) -> Poll<Self::Output> {
+        let mut state = self.state.lock().unwrap_or_else(PoisonError::into_inner);
+        match state.result.take() {
+            Some(result) => Poll::Ready(result),
+            None => {
+                state.waker = Some(cx.waker().clone());
+                Poll::Pending
+            }
+        }
+    }
+}
+
+unsafe extern "C" fn async_write_callback(
+    _ticket: u64,
+    mut status: ffi::zvec_status_t,
+    results: ffi::zvec_write_results_t,
+    user_data: *mut c_void,
+) {
+    let state = Arc::from_raw(user_data as *const Mutex<AsyncWriteState>);
+    let results = WriteResults { inner: results };
+    let result = check_status(status).map(|()| results);
+    ffi::zvec_status_free(&mut status);
+
+    // Unwinding out of an extern "C" function aborts, so a poisoned lock is
+    // taken over rather than unwrapped; the state is only ever a slot.
+    let waker = {
+        let mut state = state.lock().unwrap_or_else(PoisonError::into_inner);
+        state.result = Some(result);
+        state.waker.take()
+    };
+    if let Some(waker) = waker {
+        waker.wake();
+    }
+}
+
 // SAFETY: Collection wraps a raw pointer to zvec C++ object.
 // The underlying zvec library uses internal mutexes (schema_handle_mtx_, write_mtx_)
 // for thread safety. Query operations are const and thread-safe.
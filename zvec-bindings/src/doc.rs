@@ -1,5 +1,6 @@
 use std::ffi::CString;
 use std::ptr;
+use std::time::Duration;
 
 use crate::error::{check_status, Result};
 use crate::ffi;
@@ -43,6 +44,12 @@ impl Doc {
         Self::with_pk(id)
     }
 
+    /// Clear the primary key, score, doc id and all fields so the document can
+    /// be reused for another row.
+    pub fn reset(&mut self) {
+        unsafe { ffi::zvec_doc_reset(self.ptr) };
+    }
+
     /// Set the primary key and return self for chaining.
     pub fn with_pk_mut(mut self, pk: impl Into<String>) -> Self {
         self.set_pk(pk);
@@ -145,6 +152,62 @@ impl Doc {
         check_status(status)
     }
 
+    /// Set an fp16 vector field, converting from fp32 while storing.
+    pub fn set_vector_fp16(&mut self, field: &str, vector: &[f32]) -> Result<()> {
+        let field_c = CString::new(field).unwrap();
+        let status = unsafe {
+            ffi::zvec_doc_set_vector_fp16_from_fp32(
+                self.ptr,
+                field_c.as_ptr(),
+                vector.as_ptr(),
+                vector.len(),
+            )
+        };
+        check_status(status)
+    }
+
+    /// Set an int8 vector field from fp32, storing `round(x / scale)` clamped
+    /// to `[-128, 127]`.
+    pub fn set_vector_int8_quantized(
+        &mut self,
+        field: &str,
+        vector: &[f32],
+        scale: f32,
+    ) -> Result<()> {
+        let field_c = CString::new(field).unwrap();
+        let status = unsafe {
+            ffi::zvec_doc_set_vector_int8_from_fp32(
+                self.ptr,
+                field_c.as_ptr(),
+                vector.as_ptr(),
+                vector.len(),
+                scale,
+            )
+        };
+        check_status(status)
+    }
+
+    /// Set an int4 vector field from fp32, storing `round(x / scale)` clamped
+    /// to `[-8, 7]`, two values per byte with the first in the low nibble.
+    pub fn set_vector_int4_quantized(
+        &mut self,
+        field: &str,
+        vector: &[f32],
+        scale: f32,
+    ) -> Result<()> {
+        let field_c = CString::new(field).unwrap();
+        let status = unsafe {
+            ffi::zvec_doc_set_vector_int4_from_fp32(
+                self.ptr,
+                field_c.as_ptr(),
+                vector.as_ptr(),
+                vector.len(),
+                scale,
+            )
+        };
+        check_status(status)
+    }
+
     pub fn set_sparse_vector(
         &mut self,
         field: &str,
@@ -226,28 +289,14 @@ impl Doc {
     }
 
     pub fn get_vector(&self, field: &str) -> Option<Vec<f32>> {
-        let field_c = CString::new(field).unwrap();
-        let mut buf = vec![0.0f32; 4096];
-        let actual_len = unsafe {
-            ffi::zvec_doc_get_vector_fp32(self.ptr, field_c.as_ptr(), buf.as_mut_ptr(), buf.len())
-        };
-        if actual_len == 0 {
-            return None;
-        }
-        if actual_len > buf.len() {
-            buf.resize(actual_len, 0.0);
-            unsafe {
-                ffi::zvec_doc_get_vector_fp32(
-                    self.ptr,
-                    field_c.as_ptr(),
-                    buf.as_mut_ptr(),
-                    buf.len(),
-                )
-            };
-        } else {
-            buf.truncate(actual_len);
-        }
-        Some(buf)
+        self.get_vector_view(field).map(<[f32]>::to_vec)
+    }
+
+    /// Borrow an fp32 vector field. The field is copied out of the engine
+    /// once and cached in the doc, so repeated calls do not copy again. The
+    /// cached copy is released when the doc is next modified or dropped.
+    pub fn get_vector_view(&self, field: &str) -> Option<&[f32]> {
+        fp32_view(self.ptr, field)
     }
 
     pub fn has(&self, field: &str) -> bool {
@@ -280,6 +329,120 @@ impl Drop for Doc {
     }
 }
 
+/// A reusable set of documents for ingest loops.
+///
+/// [`acquire`](DocArena::acquire) hands out an empty document, reusing one
+/// from an earlier batch when available, and [`reset`](DocArena::reset)
+/// returns all of them. Looping over fixed-size batches this way keeps the
+/// same document handles instead of allocating new ones per row.
+///
+/// # Example
+///
+/// ```rust,no_run
+/// use zvec_bindings::{create_and_open, CollectionSchema, DocArena, VectorSchema};
+///
+/// # fn main() -> zvec_bindings::Result<()> {
+/// let mut schema = CollectionSchema::new("my_collection");
+/// schema.add_field(VectorSchema::fp32("embedding", 2).into())?;
+/// let collection = create_and_open("./my_db", schema)?;
+///
+/// let mut arena = DocArena::new(100);
+/// for batch in 0..10 {
+///     arena.reset();
+///     for i in 0..100 {
+///         let doc = arena.acquire();
+///         doc.set_pk(format!("doc_{}_{}", batch, i));
+///         doc.set_vector("embedding", &[0.1, 0.2])?;
+///     }
+///     collection.insert(arena.docs())?;
+/// }
+/// # Ok(())
+/// # }
+/// ```
+pub struct DocArena {
+    docs: Vec<Doc>,
+    next: usize,
+}
+
+impl DocArena {
+    /// Create an arena with `capacity` documents allocated up front.
+    pub fn new(capacity: usize) -> Self {
+        Self {
+            docs: (0..capacity).map(|_| Doc::new()).collect(),
+            next: 0,
+        }
+    }
+
+    /// Check out an empty document, growing the arena if all are in use.
+    pub fn acquire(&mut self) -> &mut Doc {
+        if self.next == self.docs.len() {
+            self.docs.push(Doc::new());
+        } else {
+            self.docs[self.next].reset();
+        }
+        self.next += 1;
+        &mut self.docs[self.next - 1]
+    }
+
+    /// Return every checked-out document to the arena.
+    pub fn reset(&mut self) {
+        self.next = 0;
+    }
+
+    /// The documents checked out since the last [`reset`](DocArena::reset).
+    pub fn docs(&self) -> &[Doc] {
+        &self.docs[..self.next]
+    }
+
+    pub fn len(&self) -> usize {
+        self.next
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.next == 0
+    }
+}
+
+/// Timing of one query execution.
+///
+/// This splits wall time between the engine's search and the wrapper; it is
+/// not a per-stage profile. The engine reports no breakdown of its search,
+/// so `search` covers filter evaluation, index traversal, distance
+/// computation and field fetch together; `materialize` is the time spent
+/// building the result handles.
+#[derive(Debug, Clone, Copy, Default, PartialEq)]
+pub struct QueryStats {
+    pub search: Duration,
+    pub materialize: Duration,
+    pub hit_count: usize,
+    /// The query's timeout or cancel token cut it off, or too many bounded
+    /// searches were in flight to start it.
+    pub truncated: bool,
+}
+
+impl From<&ffi::zvec_query_stats_t> for QueryStats {
+    fn from(stats: &ffi::zvec_query_stats_t) -> Self {
+        Self {
+            search: Duration::from_nanos(stats.search_ns),
+            materialize: Duration::from_nanos(stats.materialize_ns),
+            hit_count: stats.hit_count,
+            truncated: stats.truncated,
+        }
+    }
+}
+
+/// View of the fp32 vector `field` of `doc`, owned by the doc handle. `None`
+/// for missing or empty fields and vectors of other element types.
+fn fp32_view<'a>(doc: *const ffi::zvec_doc_t, field: &str) -> Option<&'a [f32]> {
+    let field_c = CString::new(field).ok()?;
+    let mut view: ffi::zvec_vector_view_t = unsafe { std::mem::zeroed() };
+    let found = unsafe { ffi::zvec_doc_get_vector_view(doc, field_c.as_ptr(), &mut view) };
+    if !found || view.len == 0 || view.data_type != ffi::zvec_data_type_ZVEC_DATA_TYPE_VECTOR_FP32 {
+        return None;
+    }
+    Some(unsafe { std::slice::from_raw_parts(view.data as *const f32, view.len) })
+}
+
 pub struct DocList {
     pub(crate) inner: ffi::zvec_doc_list_t,
 }
@@ -300,6 +463,12 @@ impl DocList {
         self.inner.count == 0
     }
 
+    /// Statistics of the query that produced this list; zero for lists not
+    /// returned by a query.
+    pub fn stats(&self) -> QueryStats {
+        QueryStats::from(&self.inner.stats)
+    }
+
     pub fn get(&self, index: usize) -> Option<DocRef<'_>> {
         if index < self.inner.count {
             Some(DocRef {
@@ -438,28 +607,15 @@ impl<'a> DocRef<'a> {
     }
 
     pub fn get_vector(&self, field: &str) -> Option<Vec<f32>> {
-        let field_c = CString::new(field).unwrap();
-        let mut buf = vec![0.0f32; 4096];
-        let actual_len = unsafe {
-            ffi::zvec_doc_get_vector_fp32(self.ptr, field_c.as_ptr(), buf.as_mut_ptr(), buf.len())
-        };
-        if actual_len == 0 {
-            return None;
-        }
-        if actual_len > buf.len() {
-            buf.resize(actual_len, 0.0);
-            unsafe {
-                ffi::zvec_doc_get_vector_fp32(
-                    self.ptr,
-                    field_c.as_ptr(),
-                    buf.as_mut_ptr(),
-                    buf.len(),
-                )
-            };
-        } else {
-            buf.truncate(actual_len);
-        }
-        Some(buf)
+        self.get_vector_view(field).map(<[f32]>::to_vec)
+    }
+
+    /// Borrow an fp32 vector field. The field is copied out of the engine
+    /// once and cached with the document, so repeated calls do not copy
+    /// again. The slice stays valid as long as the list or map holding this
+    /// document.
+    pub fn get_vector_view(&self, field: &str) -> Option<&'a [f32]> {
+        fp32_view(self.ptr, field)
     }
 }
 
@@ -496,6 +652,103 @@ impl Drop for WriteResults {
     }
 }
 
+/// Compact outcome of a write, as returned by [`Collection::upsert_summary`] and
+/// friends.
+///
+/// Holds a success count and a failure bitmap instead of one status per
+/// document, so a batch in which every document succeeds costs no allocation.
+///
+/// [`Collection::upsert_summary`]: crate::Collection::upsert_summary
+pub struct WriteSummary {
+    pub(crate) inner: ffi::zvec_write_summary_t,
+}
+
+impl WriteSummary {
+    pub fn len(&self) -> usize {
+        self.inner.count
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.inner.count == 0
+    }
+
+    pub fn success_count(&self) -> usize {
+        self.inner.success_count
+    }
+
+    pub fn failure_count(&self) -> usize {
+        self.inner.count - self.inner.success_count
+    }
+
+    /// True when every document in the batch was written.
+    pub fn all_ok(&self) -> bool {
+        self.inner.success_count == self.inner.count
+    }
+
+    pub fn is_failed(&self, index: usize) -> bool {
+        if index >= self.inner.count || self.inner.failed_bitmap.is_null() {
+            return false;
+        }
+        let byte = unsafe { *self.inner.failed_bitmap.add(index / 8) };
+        byte & (1 << (index % 8)) != 0
+    }
+
+    pub fn get(&self, index: usize) -> Option<crate::error::Result<()>> {
+        if index >= self.inner.count {
+            return None;
+        }
+        if !self.is_failed(index) {
+            return Some(Ok(()));
+        }
+        self.failed_indices()
+            .binary_search(&index)
+            .ok()
+            .map(|n| Err(self.failure_error(n)))
+    }
+
+    pub fn iter(&self) -> impl Iterator<Item = crate::error::Result<()>> + '_ {
+        let mut failures = self.failures().peekable();
+        (0..self.inner.count).map(move |i| match failures.peek() {
+            Some((index, _)) if *index == i => Err(failures.next().unwrap().1),
+            _ => Ok(()),
+        })
+    }
+
+    /// Iterate over the failed documents as `(index, error)` pairs.
+    ///
+    /// Errors carry the first message reported for their status code.
+    pub fn failures(&self) -> impl Iterator<Item = (usize, crate::error::Error)> + '_ {
+        self.failed_indices()
+            .iter()
+            .enumerate()
+            .map(move |(n, &i)| (i, self.failure_error(n)))
+    }
+
+    /// Indices of the failed documents, ascending.
+    fn failed_indices(&self) -> &[usize] {
+        if self.inner.failure_count == 0 || self.inner.failed_indices.is_null() {
+            return &[];
+        }
+        unsafe { std::slice::from_raw_parts(self.inner.failed_indices, self.inner.failure_count) }
+    }
+
+    /// Error of the `n`-th failed document.
+    fn failure_error(&self, n: usize) -> crate::error::Error {
+        let code = unsafe { *self.inner.failed_codes.add(n) } as usize;
+        let status = ffi::zvec_status_t {
+            code: code as ffi::zvec_status_code_t,
+            message: self.inner.messages[code] as *const _,
+        };
+        check_status(status).unwrap_err()
+    }
+}
+
+impl Drop for WriteSummary {
+    fn drop(&mut self) {
+        unsafe { ffi::zvec_write_summary_free(&mut self.inner) };
+    }
+}
+
 pub struct DocMap {
     pub(crate) inner: ffi::zvec_doc_map_t,
 }
@@ -551,3 +804,4 @@ impl Drop for DocMap {
 unsafe impl Send for DocList {}
 unsafe impl Send for DocMap {}
 unsafe impl Send for WriteResults {}
+unsafe impl Send for WriteSummary {}
@@ -109,6 +109,8 @@
 
 pub use zvec_sys as ffi;
 
+pub mod batch;
+pub mod bulk;
 pub mod collection;
 pub mod doc;
 pub mod error;
@@ -120,15 +122,22 @@ pub mod types;
 #[cfg(feature = "sync")]
 pub mod sync;
 
+pub use batch::ColumnarBatch;
+pub use bulk::BulkWriter;
 pub use collection::Collection;
+pub use collection::CollectionOptions;
 pub use collection::CollectionStats;
 pub use collection::IndexParams;
-pub use doc::Doc;
+pub use collection::WriteFuture;
+pub use doc::{Doc, DocArena, QueryStats};
 pub use error::{check_status, Error, Result, StatusCode};
-pub use query::{GroupByVectorQuery, HnswQueryParam, IVFQueryParam, VectorQuery};
+pub use query::{
+    CancelToken, FlatColumn, FlatResults, GroupByVectorQuery, HnswQueryParam, IVFQueryParam,
+    PreparedQuery, SearchIterator, VectorQuery,
+};
 pub use rerank::{RrfReRanker, WeightedReRanker};
 pub use schema::{CollectionSchema, FieldSchema, VectorSchema};
-pub use types::{DataType, IndexType, LogLevel, LogType, MetricType, QuantizeType};
+pub use types::{DataType, IndexType, LogLevel, LogType, MetricType, Operator, QuantizeType};
 
 #[cfg(feature = "sync")]
 pub use sync::{create_and_open_shared, open_shared, SharedCollection};
@@ -142,6 +151,13 @@ pub fn init() -> Result<()> {
     }
 }
 
+/// Set the number of threads in the query pool shared by batch queries and
+/// bounded queries. `0` uses one per core. The pool is sized at its first
+/// use, so call this before running such queries.
+pub fn set_thread_pool_size(size: usize) {
+    unsafe { ffi::zvec_set_thread_pool_size(size) };
+}
+
 pub fn list_registered_metrics() -> Vec<String> {
     let mut metrics_ptr: *mut *const std::os::raw::c_char = std::ptr::null_mut();
     let count = unsafe { ffi::zvec_list_registered_metrics(&mut metrics_ptr) };
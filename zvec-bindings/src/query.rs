@@ -1,7 +1,9 @@
 use std::ffi::CString;
 
+use crate::doc::DocList;
 use crate::error::{check_status, Result};
 use crate::ffi;
+use crate::types::DataType;
 
 pub struct HnswQueryParam {
     pub(crate) ptr: *mut ffi::zvec_query_params_t,
@@ -56,6 +58,47 @@ pub enum QueryParam {
     IVF(IVFQueryParam),
 }
 
+/// A cancellation flag shared by the queries it is attached to.
+///
+/// Cancelling from any thread makes running and future executions of those
+/// queries give up, as if their timeout had passed. Cancellation is final.
+pub struct CancelToken {
+    pub(crate) ptr: *mut ffi::zvec_cancel_token_t,
+}
+
+impl CancelToken {
+    pub fn new() -> Self {
+        let ptr = unsafe { ffi::zvec_cancel_token_new() };
+        Self { ptr }
+    }
+
+    pub fn cancel(&self) {
+        unsafe { ffi::zvec_cancel_token_cancel(self.ptr) };
+    }
+
+    pub fn is_cancelled(&self) -> bool {
+        unsafe { ffi::zvec_cancel_token_is_cancelled(self.ptr) }
+    }
+}
+
+impl Default for CancelToken {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl Drop for CancelToken {
+    fn drop(&mut self) {
+        if !self.ptr.is_null() {
+            unsafe { ffi::zvec_cancel_token_free(self.ptr) };
+        }
+    }
+}
+
+// SAFETY: The token is an atomic flag; all operations on it are thread-safe.
+unsafe impl Send for CancelToken {}
+unsafe impl Sync for CancelToken {}
+
 pub struct VectorQuery {
     pub(crate) ptr: *mut ffi::zvec_vector_query_t,
     id: Option<String>,
@@ -103,6 +146,63 @@ impl VectorQuery {
         self
     }
 
+    /// Time budget for each execution of this query. The caller stops
+    /// waiting for a query still running when it is spent and gets no hits,
+    /// though the search itself runs on; see
+    /// [`Collection::query_bounded`](crate::Collection::query_bounded).
+    pub fn timeout(self, timeout: std::time::Duration) -> Self {
+        let millis = u64::try_from(timeout.as_millis()).unwrap_or(u64::MAX);
+        unsafe { ffi::zvec_vector_query_set_timeout_ms(self.ptr, millis) };
+        self
+    }
+
+    /// Abandon executions of this query once `token` is cancelled.
+    pub fn cancel_token(self, token: &CancelToken) -> Self {
+        unsafe { ffi::zvec_vector_query_set_cancel_token(self.ptr, token.ptr) };
+        self
+    }
+
+    /// Return only the pk, doc id and score of each hit.
+    ///
+    /// Output fields and the vector are dropped so the engine skips the
+    /// forward store; combine with
+    /// [`Collection::query_flat`](crate::Collection::query_flat) for the
+    /// cheapest candidate retrieval. `ids_only(false)` restores the output
+    /// fields, `include_vector` and `include_doc_id` set before.
+    pub fn ids_only(self, ids_only: bool) -> Self {
+        unsafe { ffi::zvec_vector_query_set_ids_only(self.ptr, ids_only) };
+        self
+    }
+
+    /// Return the hits within `radius` among the best `max_results`, instead
+    /// of a fixed `topk`.
+    ///
+    /// The metric of the field's index fixes the direction: for
+    /// [`MetricType::Ip`](crate::MetricType::Ip) hits score at least `radius`,
+    /// for distance metrics at most `radius`. This filters an ordinary search
+    /// for the best `max_results` hits rather than searching by radius, so it
+    /// costs the same as that search and misses hits in the radius beyond
+    /// the best `max_results`, which must be positive.
+    pub fn range(self, radius: f32, max_results: usize) -> Result<Self> {
+        let status = unsafe { ffi::zvec_vector_query_set_range(self.ptr, radius, max_results) };
+        check_status(status)?;
+        Ok(self)
+    }
+
+    /// Two-stage search for quantized (INT8/INT4) indexes: take
+    /// `topk * factor` candidates from the index, re-score them with their
+    /// stored fp32 vectors under the metric of the field's index and keep the
+    /// best `topk`. Scores are then exact: squared distance for L2, inner
+    /// product for IP and `1 - cosine similarity` for Cosine. With
+    /// [`range`](Self::range), every hit in the radius is re-scored and hits
+    /// whose exact score leaves it are dropped. Unless the query includes
+    /// vectors, they are read with one fetch after the search, and the query
+    /// fails if that fetch does. A factor of 0 or 1 disables it.
+    pub fn rerank(self, factor: u32) -> Self {
+        unsafe { ffi::zvec_vector_query_set_rerank(self.ptr, factor) };
+        self
+    }
+
     pub fn query_params(self, params: QueryParam) -> Self {
         let ptr = match &params {
             QueryParam::Hnsw(p) => p.ptr,
@@ -150,13 +250,24 @@ impl VectorQuery {
         Ok(self)
     }
 
+    /// Search with the vector stored for the doc with primary key `id`
+    /// ("more like this"). The vector is read inside the wrapper when the
+    /// query runs, so it never crosses into Rust.
     pub fn id(self, id: impl Into<String>) -> Self {
+        let id = id.into();
+        let id_c = CString::new(id.as_str()).unwrap();
+        unsafe { ffi::zvec_vector_query_set_by_pk(self.ptr, id_c.as_ptr()) };
         let ptr = self.ptr;
         std::mem::forget(self);
-        Self {
-            ptr,
-            id: Some(id.into()),
-        }
+        Self { ptr, id: Some(id) }
+    }
+
+    /// Leave the source doc of an [`id`](Self::id) query out of its own
+    /// results; `topk`, or `max_results` of a [`range`](Self::range) query,
+    /// still counts the other docs only.
+    pub fn exclude_source(self, exclude: bool) -> Self {
+        unsafe { ffi::zvec_vector_query_set_exclude_source(self.ptr, exclude) };
+        self
     }
 
     pub fn has_id(&self) -> bool {
@@ -170,6 +281,24 @@ impl VectorQuery {
     pub fn get_id(&self) -> Option<&str> {
         self.id.as_deref()
     }
+
+    /// Whether hits carry their vectors.
+    pub fn includes_vector(&self) -> bool {
+        unsafe { ffi::zvec_vector_query_include_vector(self.ptr) }
+    }
+
+    /// Whether hits carry their internal doc ids.
+    pub fn includes_doc_id(&self) -> bool {
+        unsafe { ffi::zvec_vector_query_include_doc_id(self.ptr) }
+    }
+
+    /// The vector field this query searches.
+    pub fn field_name(&self) -> &str {
+        unsafe {
+            let ptr = ffi::zvec_vector_query_field_name(self.ptr);
+            std::ffi::CStr::from_ptr(ptr).to_str().unwrap_or("")
+        }
+    }
 }
 
 impl Drop for VectorQuery {
@@ -180,6 +309,34 @@ impl Drop for VectorQuery {
     }
 }
 
+/// A [`VectorQuery`] checked against a collection schema once, for reuse
+/// across many searches.
+///
+/// Created by [`Collection::prepare`](crate::Collection::prepare) and run with
+/// [`Collection::query_prepared`](crate::Collection::query_prepared). Filter,
+/// output fields and params stay fixed; [`set_vector`](PreparedQuery::set_vector)
+/// overwrites the query vector in place without reallocating.
+pub struct PreparedQuery {
+    pub(crate) query: VectorQuery,
+    pub(crate) dimension: usize,
+}
+
+impl PreparedQuery {
+    /// Dimension of the queried vector field; 0 for sparse fields, whose
+    /// vector is fixed when the query is prepared.
+    pub fn dimension(&self) -> usize {
+        self.dimension
+    }
+
+    /// Replace the query vector; `vector` must have [`dimension`](PreparedQuery::dimension) values.
+    pub fn set_vector(&mut self, vector: &[f32]) -> Result<()> {
+        let status = unsafe {
+            ffi::zvec_vector_query_update_vector_fp32(self.query.ptr, vector.as_ptr(), vector.len())
+        };
+        check_status(status)
+    }
+}
+
 pub struct GroupByVectorQuery {
     pub(crate) ptr: *mut ffi::zvec_group_by_vector_query_t,
 }
@@ -244,6 +401,74 @@ impl Drop for GroupByVectorQuery {
     }
 }
 
+/// A cursor over the hits of a query, yielding them in pages.
+///
+/// Created by [`Collection::search_iter`](crate::Collection::search_iter).
+/// Each page holds up to the page size of hits not returned before; iteration
+/// ends after the last hit. Pages are served from hits buffered by the last
+/// search; when they run out the whole query runs again for four times as
+/// many hits, so deep paging costs more than a single search with a large
+/// `topk`. Iterator searches bypass the result cache.
+///
+/// If the query's timeout or cancel token cuts a search off, iteration ends
+/// after that page, whose stats report it truncated; a cut-off page with no
+/// hits is yielded as an error instead.
+pub struct SearchIterator<'a> {
+    pub(crate) ptr: *mut ffi::zvec_search_iterator_t,
+    pub(crate) page_size: usize,
+    pub(crate) finished: bool,
+    pub(crate) _marker: std::marker::PhantomData<&'a crate::Collection>,
+}
+
+impl SearchIterator<'_> {
+    /// Fetch the next `count` hits; an empty list means no hits are left,
+    /// unless its stats report the query's time budget cut the search off.
+    pub fn next_batch(&mut self, count: usize) -> Result<DocList> {
+        let mut results: ffi::zvec_doc_list_t = unsafe { std::mem::zeroed() };
+        let status = unsafe { ffi::zvec_search_iterator_next(self.ptr, count, &mut results) };
+        check_status(status)?;
+        Ok(DocList { inner: results })
+    }
+}
+
+impl Iterator for SearchIterator<'_> {
+    type Item = Result<DocList>;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.finished {
+            return None;
+        }
+        let page = match self.next_batch(self.page_size) {
+            Ok(page) => page,
+            Err(e) => {
+                self.finished = true;
+                return Some(Err(e));
+            }
+        };
+        let truncated = page.stats().truncated;
+        self.finished = page.is_empty() || truncated;
+        match (page.is_empty(), truncated) {
+            (true, true) => Some(Err(crate::error::Error::FailedPrecondition(
+                "search cut off by the query's timeout or cancel token".into(),
+            ))),
+            (true, false) => None,
+            _ => Some(Ok(page)),
+        }
+    }
+}
+
+impl Drop for SearchIterator<'_> {
+    fn drop(&mut self) {
+        if !self.ptr.is_null() {
+            unsafe { ffi::zvec_search_iterator_free(self.ptr) };
+        }
+    }
+}
+
+// SAFETY: The iterator exclusively owns its C handle; the collection it reads
+// from is borrowed for its lifetime.
+unsafe impl Send for SearchIterator<'_> {}
+
 pub struct GroupResults {
     pub(crate) inner: ffi::zvec_group_results_t,
 }
@@ -271,6 +496,11 @@ impl GroupResults {
     pub fn iter(&self) -> impl Iterator<Item = GroupResultRef<'_>> + '_ {
         (0..self.len()).filter_map(|i| self.get(i))
     }
+
+    /// Statistics of the grouped query; `hit_count` counts docs in all groups.
+    pub fn stats(&self) -> crate::doc::QueryStats {
+        crate::doc::QueryStats::from(&self.inner.stats)
+    }
 }
 
 impl Drop for GroupResults {
@@ -304,3 +534,113 @@ impl<'a> GroupResultRef<'a> {
 
 // SAFETY: GroupResults owns its FFI data and can be safely sent between threads.
 unsafe impl Send for GroupResults {}
+
+/// One scalar field of [`FlatResults`], a value per hit.
+#[derive(Debug, Clone, Copy)]
+pub enum FlatColumn<'a> {
+    Bool(&'a [bool]),
+    Int32(&'a [i32]),
+    Int64(&'a [i64]),
+    UInt32(&'a [u32]),
+    UInt64(&'a [u64]),
+    Float(&'a [f32]),
+    Double(&'a [f64]),
+}
+
+/// Query hits stored as contiguous arrays instead of one document per hit.
+///
+/// Returned by [`Collection::query_flat`](crate::Collection::query_flat).
+/// Scores, doc ids and the requested scalar fields are plain slices indexed by
+/// hit rank; primary keys share a single buffer.
+pub struct FlatResults {
+    pub(crate) inner: ffi::zvec_flat_results_t,
+}
+
+impl FlatResults {
+    pub fn len(&self) -> usize {
+        self.inner.count
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.inner.count == 0
+    }
+
+    /// Primary key of the hit at `index`.
+    pub fn pk(&self, index: usize) -> Option<&str> {
+        if index >= self.inner.count {
+            return None;
+        }
+        unsafe {
+            let begin = *self.inner.pk_offsets.add(index);
+            let end = *self.inner.pk_offsets.add(index + 1);
+            let bytes =
+                std::slice::from_raw_parts(self.inner.pk_data.add(begin) as *const u8, end - begin);
+            std::str::from_utf8(bytes).ok()
+        }
+    }
+
+    pub fn pks(&self) -> impl Iterator<Item = &str> + '_ {
+        (0..self.len()).map(|i| self.pk(i).unwrap_or(""))
+    }
+
+    pub fn scores(&self) -> &[f32] {
+        unsafe { std::slice::from_raw_parts(self.inner.scores, self.inner.count) }
+    }
+
+    /// Internal doc ids; zero unless the query included doc ids.
+    pub fn doc_ids(&self) -> &[u64] {
+        unsafe { std::slice::from_raw_parts(self.inner.doc_ids, self.inner.count) }
+    }
+
+    /// Values of a requested scalar field.
+    pub fn column(&self, name: &str) -> Option<FlatColumn<'_>> {
+        let column = self.find_column(name)?;
+        let count = self.inner.count;
+        unsafe {
+            let data = column.data;
+            Some(match DataType::from(column.data_type) {
+                DataType::Bool => FlatColumn::Bool(std::slice::from_raw_parts(data as _, count)),
+                DataType::Int32 => FlatColumn::Int32(std::slice::from_raw_parts(data as _, count)),
+                DataType::Int64 => FlatColumn::Int64(std::slice::from_raw_parts(data as _, count)),
+                DataType::UInt32 => {
+                    FlatColumn::UInt32(std::slice::from_raw_parts(data as _, count))
+                }
+                DataType::UInt64 => {
+                    FlatColumn::UInt64(std::slice::from_raw_parts(data as _, count))
+                }
+                DataType::Float => FlatColumn::Float(std::slice::from_raw_parts(data as _, count)),
+                DataType::Double => {
+                    FlatColumn::Double(std::slice::from_raw_parts(data as _, count))
+                }
+                _ => return None,
+            })
+        }
+    }
+
+    /// Per-hit flags telling whether the hit has a value for the field.
+    pub fn column_valid(&self, name: &str) -> Option<&[bool]> {
+        let column = self.find_column(name)?;
+        Some(unsafe { std::slice::from_raw_parts(column.valid, self.inner.count) })
+    }
+
+    fn find_column(&self, name: &str) -> Option<&ffi::zvec_flat_column_t> {
+        let columns = if self.inner.column_count == 0 {
+            &[][..]
+        } else {
+            unsafe { std::slice::from_raw_parts(self.inner.columns, self.inner.column_count) }
+        };
+        columns.iter().find(|c| {
+            !c.name.is_null()
+                && unsafe { std::ffi::CStr::from_ptr(c.name) }.to_bytes() == name.as_bytes()
+        })
+    }
+}
+
+impl Drop for FlatResults {
+    fn drop(&mut self) {
+        unsafe { ffi::zvec_flat_results_free(&mut self.inner) };
+    }
+}
+
+// SAFETY: FlatResults owns its FFI data and can be safely sent between threads.
+unsafe impl Send for FlatResults {}
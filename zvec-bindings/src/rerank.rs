@@ -90,6 +90,11 @@ impl WeightedReRanker {
         self.metric
     }
 
+    /// Weight of the sub-query over `field`, 1.0 when none was set.
+    pub fn weight(&self, field: &str) -> f64 {
+        self.weights.get(field).copied().unwrap_or(1.0)
+    }
+
     fn normalize_score(&self, score: f32) -> f64 {
         match self.metric {
             MetricType::L2 => 1.0 - 2.0 * (score as f64).atan() / std::f64::consts::PI,
@@ -106,11 +111,7 @@ impl WeightedReRanker {
         let mut weighted_scores: HashMap<String, f64> = HashMap::new();
 
         for (vector_name, docs) in query_results.iter() {
-            let weight = self
-                .weights
-                .get(vector_name.as_ref())
-                .copied()
-                .unwrap_or(1.0);
+            let weight = self.weight(vector_name.as_ref());
             for (doc_id, score) in docs.iter() {
                 let normalized = self.normalize_score(*score);
                 let weighted = normalized * weight;
@@ -1,11 +1,14 @@
 use std::path::Path;
 use std::sync::{Arc, RwLock};
 
-use crate::collection::Collection;
-use crate::doc::{Doc, DocList, DocMap, WriteResults};
+use crate::batch::ColumnarBatch;
+use crate::collection::{Collection, WriteFuture};
+use crate::doc::{Doc, DocList, DocMap, WriteResults, WriteSummary};
 use crate::error::Result;
-use crate::query::{GroupByVectorQuery, GroupResults, VectorQuery};
+use crate::query::{FlatResults, GroupByVectorQuery, GroupResults, PreparedQuery, VectorQuery};
+use crate::rerank::{RrfReRanker, WeightedReRanker};
 use crate::schema::CollectionSchema;
+use crate::types::DataType;
 use crate::IndexParams;
 
 /// A thread-safe wrapper around [`Collection`] for concurrent access.
@@ -74,6 +77,92 @@ impl SharedCollection {
         guard.group_by_query(query)
     }
 
+    /// Validate a query against the collection schema for repeated use.
+    ///
+    /// Takes a read lock, allowing concurrent queries.
+    pub fn prepare(&self, query: VectorQuery) -> Result<PreparedQuery> {
+        let guard = self.inner.read().expect("collection lock poisoned");
+        guard.prepare(query)
+    }
+
+    /// Execute a prepared query.
+    ///
+    /// Takes a read lock, allowing concurrent queries.
+    pub fn query_prepared(&self, query: &PreparedQuery) -> Result<DocList> {
+        let guard = self.inner.read().expect("collection lock poisoned");
+        guard.query_prepared(query)
+    }
+
+    /// Execute a vector similarity search, returning hits as flat arrays.
+    ///
+    /// Takes a read lock, allowing concurrent queries.
+    pub fn query_flat(
+        &self,
+        query: VectorQuery,
+        columns: &[(&str, DataType)],
+    ) -> Result<FlatResults> {
+        let guard = self.inner.read().expect("collection lock poisoned");
+        guard.query_flat(query, columns)
+    }
+
+    /// Execute a vector similarity search within the query's time budget.
+    ///
+    /// Takes a read lock, allowing concurrent queries.
+    pub fn query_bounded(&self, query: VectorQuery) -> Result<(DocList, bool)> {
+        let guard = self.inner.read().expect("collection lock poisoned");
+        guard.query_bounded(query)
+    }
+
+    /// Run several queries concurrently and fuse their hits by Reciprocal Rank Fusion.
+    ///
+    /// Takes a read lock, allowing concurrent queries.
+    pub fn hybrid_query_rrf(
+        &self,
+        queries: &[VectorQuery],
+        reranker: &RrfReRanker,
+    ) -> Result<DocList> {
+        let guard = self.inner.read().expect("collection lock poisoned");
+        guard.hybrid_query_rrf(queries, reranker)
+    }
+
+    /// Run several queries concurrently and fuse their hits by weighted score.
+    ///
+    /// Takes a read lock, allowing concurrent queries.
+    pub fn hybrid_query_weighted(
+        &self,
+        queries: &[VectorQuery],
+        reranker: &WeightedReRanker,
+    ) -> Result<DocList> {
+        let guard = self.inner.read().expect("collection lock poisoned");
+        guard.hybrid_query_weighted(queries, reranker)
+    }
+
+    /// Execute one query per row of a row-major query matrix.
+    ///
+    /// Takes a read lock, allowing concurrent queries.
+    pub fn query_batch(
+        &self,
+        query: &VectorQuery,
+        vectors: &[f32],
+        dimension: usize,
+    ) -> Result<Vec<DocList>> {
+        let guard = self.inner.read().expect("collection lock poisoned");
+        guard.query_batch(query, vectors, dimension)
+    }
+
+    /// Execute one query per row, reporting whether the batch was cut off.
+    ///
+    /// Takes a read lock, allowing concurrent queries.
+    pub fn query_batch_bounded(
+        &self,
+        query: &VectorQuery,
+        vectors: &[f32],
+        dimension: usize,
+    ) -> Result<(Vec<DocList>, bool)> {
+        let guard = self.inner.read().expect("collection lock poisoned");
+        guard.query_batch_bounded(query, vectors, dimension)
+    }
+
     /// Fetch documents by primary key.
     ///
     /// Takes a read lock, allowing concurrent fetches.
@@ -82,6 +171,20 @@ impl SharedCollection {
         guard.fetch(pks)
     }
 
+    /// Fetch vectors into a caller-provided row-major matrix.
+    ///
+    /// Takes a read lock, allowing concurrent fetches.
+    pub fn fetch_vectors_into(
+        &self,
+        pks: &[&str],
+        field: &str,
+        dimension: usize,
+        out: &mut [f32],
+    ) -> Result<Vec<bool>> {
+        let guard = self.inner.read().expect("collection lock poisoned");
+        guard.fetch_vectors_into(pks, field, dimension, out)
+    }
+
     /// Get the filesystem path where this collection is stored.
     pub fn path(&self) -> Result<String> {
         let guard = self.inner.read().expect("collection lock poisoned");
@@ -114,6 +217,62 @@ impl SharedCollection {
         guard.update(docs)
     }
 
+    /// Insert documents, taking ownership of them.
+    ///
+    /// Takes a write lock, exclusive access.
+    pub fn insert_owned(&self, docs: Vec<Doc>) -> Result<WriteResults> {
+        let guard = self.inner.write().expect("collection lock poisoned");
+        guard.insert_owned(docs)
+    }
+
+    /// Upsert documents, taking ownership of them.
+    ///
+    /// Takes a write lock, exclusive access.
+    pub fn upsert_owned(&self, docs: Vec<Doc>) -> Result<WriteResults> {
+        let guard = self.inner.write().expect("collection lock poisoned");
+        guard.upsert_owned(docs)
+    }
+
+    /// Update documents, taking ownership of them.
+    ///
+    /// Takes a write lock, exclusive access.
+    pub fn update_owned(&self, docs: Vec<Doc>) -> Result<WriteResults> {
+        let guard = self.inner.write().expect("collection lock poisoned");
+        guard.update_owned(docs)
+    }
+
+    /// Insert a columnar batch of documents.
+    ///
+    /// Takes a write lock, exclusive access.
+    pub fn insert_columnar(&self, batch: &ColumnarBatch<'_>) -> Result<WriteResults> {
+        let guard = self.inner.write().expect("collection lock poisoned");
+        guard.insert_columnar(batch)
+    }
+
+    /// Upsert a columnar batch of documents.
+    ///
+    /// Takes a write lock, exclusive access.
+    pub fn upsert_columnar(&self, batch: &ColumnarBatch<'_>) -> Result<WriteResults> {
+        let guard = self.inner.write().expect("collection lock poisoned");
+        guard.upsert_columnar(batch)
+    }
+
+    /// Queue an insert; the returned future resolves when it completes.
+    ///
+    /// Takes a write lock only while queueing.
+    pub fn insert_async(&self, docs: &[Doc]) -> WriteFuture {
+        let guard = self.inner.write().expect("collection lock poisoned");
+        guard.insert_async(docs)
+    }
+
+    /// Queue an upsert; the returned future resolves when it completes.
+    ///
+    /// Takes a write lock only while queueing.
+    pub fn upsert_async(&self, docs: &[Doc]) -> WriteFuture {
+        let guard = self.inner.write().expect("collection lock poisoned");
+        guard.upsert_async(docs)
+    }
+
     /// Delete documents by primary key.
     ///
     /// Takes a write lock, exclusive access.
@@ -122,6 +281,38 @@ impl SharedCollection {
         guard.delete(pks)
     }
 
+    /// Insert documents, reporting the outcome as a [`WriteSummary`].
+    ///
+    /// Takes a write lock, exclusive access.
+    pub fn insert_summary(&self, docs: &[Doc]) -> Result<WriteSummary> {
+        let guard = self.inner.write().expect("collection lock poisoned");
+        guard.insert_summary(docs)
+    }
+
+    /// Upsert documents, reporting the outcome as a [`WriteSummary`].
+    ///
+    /// Takes a write lock, exclusive access.
+    pub fn upsert_summary(&self, docs: &[Doc]) -> Result<WriteSummary> {
+        let guard = self.inner.write().expect("collection lock poisoned");
+        guard.upsert_summary(docs)
+    }
+
+    /// Update documents, reporting the outcome as a [`WriteSummary`].
+    ///
+    /// Takes a write lock, exclusive access.
+    pub fn update_summary(&self, docs: &[Doc]) -> Result<WriteSummary> {
+        let guard = self.inner.write().expect("collection lock poisoned");
+        guard.update_summary(docs)
+    }
+
+    /// Delete documents by primary key, reporting the outcome as a [`WriteSummary`].
+    ///
+    /// Takes a write lock, exclusive access.
+    pub fn delete_summary(&self, pks: &[&str]) -> Result<WriteSummary> {
+        let guard = self.inner.write().expect("collection lock poisoned");
+        guard.delete_summary(pks)
+    }
+
     /// Delete documents matching a filter expression.
     ///
     /// Takes a write lock, exclusive access.
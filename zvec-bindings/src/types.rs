@@ -256,3 +256,34 @@ impl From<QuantizeType> for zvec_quantize_type {
         }
     }
 }
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+#[repr(u32)]
+pub enum Operator {
+    Insert = 0,
+    Upsert = 1,
+    Update = 2,
+    Delete = 3,
+}
+
+impl From<zvec_operator> for Operator {
+    fn from(op: zvec_operator) -> Self {
+        match op {
+            zvec_operator_ZVEC_OPERATOR_INSERT => Operator::Insert,
+            zvec_operator_ZVEC_OPERATOR_UPSERT => Operator::Upsert,
+            zvec_operator_ZVEC_OPERATOR_UPDATE => Operator::Update,
+            _ => Operator::Delete,
+        }
+    }
+}
+
+impl From<Operator> for zvec_operator {
+    fn from(op: Operator) -> Self {
+        match op {
+            Operator::Insert => zvec_operator_ZVEC_OPERATOR_INSERT,
+            Operator::Upsert => zvec_operator_ZVEC_OPERATOR_UPSERT,
+            Operator::Update => zvec_operator_ZVEC_OPERATOR_UPDATE,
+            Operator::Delete => zvec_operator_ZVEC_OPERATOR_DELETE,
+        }
+    }
+}
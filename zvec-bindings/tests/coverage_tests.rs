@@ -1,8 +1,8 @@
 use tempfile::TempDir;
 use zvec_bindings::{
-    create_and_open, open, Collection, CollectionSchema, DataType, Doc, FieldSchema,
-    GroupByVectorQuery, HnswQueryParam, IVFQueryParam, IndexParams, IndexType, LogLevel, LogType,
-    MetricType, QuantizeType, StatusCode, VectorQuery, VectorSchema,
+    create_and_open, open, Collection, CollectionSchema, ColumnarBatch, DataType, Doc, DocArena,
+    FieldSchema, GroupByVectorQuery, HnswQueryParam, IVFQueryParam, IndexParams, IndexType,
+    LogLevel, LogType, MetricType, QuantizeType, StatusCode, VectorQuery, VectorSchema,
 };
 
 fn tempdir() -> zvec_bindings::Result<TempDir> {
@@ -132,6 +132,124 @@ mod coverage_tests {
         Ok(())
     }
 
+    #[test]
+    fn test_doc_quantizing_setters() -> zvec_bindings::Result<()> {
+        let values: Vec<f32> = (0..19).map(|i| i as f32 * 0.25 - 2.0).collect();
+        let mut doc = Doc::id("quantized");
+        doc.set_vector_fp16("half", &values)?;
+        doc.set_vector_int8_quantized("byte", &values, 0.05)?;
+        doc.set_vector_int4_quantized("nibble", &values, 0.5)?;
+        assert!(doc.has("half"));
+        assert!(doc.has("byte"));
+        assert!(doc.has("nibble"));
+
+        assert!(doc.set_vector_int8_quantized("byte", &values, 0.0).is_err());
+        assert!(doc
+            .set_vector_int4_quantized("nibble", &values, f32::NAN)
+            .is_err());
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_doc_quantizing_simd_matches_scalar() {
+        // Ties, a value where x / scale and x * (1 / scale) round apart,
+        // NaNs with sign and payload, and an out-of-range value.
+        let scale = 0.1f32;
+        let head = [
+            0.25f32,
+            0.35,
+            -0.25,
+            f32::from_bits(0x40D1_9999),
+            f32::NAN,
+            f32::from_bits(0xFFC1_2345),
+            f32::from_bits(0x7FC1_2345),
+            1e9,
+        ];
+        // The first 8 values take the vectorized path, the repeated 7 the
+        // scalar tail.
+        let values: Vec<f32> = head.iter().chain(&head[..7]).copied().collect();
+
+        let convert = |int8: bool| unsafe {
+            let doc = zvec_bindings::ffi::zvec_doc_new();
+            let field = std::ffi::CString::new("v").unwrap();
+            let status = if int8 {
+                zvec_bindings::ffi::zvec_doc_set_vector_int8_from_fp32(
+                    doc,
+                    field.as_ptr(),
+                    values.as_ptr(),
+                    values.len(),
+                    scale,
+                )
+            } else {
+                zvec_bindings::ffi::zvec_doc_set_vector_fp16_from_fp32(
+                    doc,
+                    field.as_ptr(),
+                    values.as_ptr(),
+                    values.len(),
+                )
+            };
+            assert_eq!(
+                status.code,
+                zvec_bindings::ffi::zvec_status_code_ZVEC_STATUS_OK
+            );
+            let mut view: zvec_bindings::ffi::zvec_vector_view_t = std::mem::zeroed();
+            assert!(zvec_bindings::ffi::zvec_doc_get_vector_view(
+                doc,
+                field.as_ptr(),
+                &mut view
+            ));
+            let bytes = if int8 { 1 } else { 2 };
+            let raw = std::slice::from_raw_parts(view.data as *const u8, view.len * bytes);
+            let out: Vec<u16> = raw
+                .chunks(bytes)
+                .map(|c| c.iter().rev().fold(0u16, |acc, b| (acc << 8) | *b as u16))
+                .collect();
+            zvec_bindings::ffi::zvec_doc_free(doc);
+            out
+        };
+
+        let int8: Vec<i8> = convert(true).iter().map(|b| *b as u8 as i8).collect();
+        assert_eq!(&int8[..8], &[2, 4, -2, 65, -128, -128, -128, 127]);
+        assert_eq!(&int8[8..], &int8[..7]);
+
+        let half = convert(false);
+        assert_eq!(&half[4..7], &[0x7E00, 0xFE09, 0x7E09]);
+        assert_eq!(&half[8..], &half[..7]);
+    }
+
+    #[test]
+    fn test_doc_reset_and_arena() -> zvec_bindings::Result<()> {
+        let mut doc = Doc::id("reset_me").with_string("name", "value")?;
+        doc.reset();
+        assert_eq!(doc.pk(), "");
+        assert!(!doc.has("name"));
+
+        let mut arena = DocArena::new(2);
+        for i in 0..3 {
+            arena.acquire().set_string("name", &format!("row_{}", i))?;
+        }
+        assert_eq!(arena.len(), 3);
+        assert_eq!(arena.docs()[2].get_string("name"), Some("row_2"));
+        arena.reset();
+        assert!(arena.is_empty());
+        assert!(!arena.acquire().has("name"));
+
+        unsafe {
+            let arena = zvec_bindings::ffi::zvec_doc_arena_new(1);
+            let first = zvec_bindings::ffi::zvec_doc_arena_acquire(arena);
+            let second = zvec_bindings::ffi::zvec_doc_arena_acquire(arena);
+            assert_ne!(first, second);
+            zvec_bindings::ffi::zvec_doc_free(first);
+            zvec_bindings::ffi::zvec_doc_arena_reset(arena);
+            assert_eq!(zvec_bindings::ffi::zvec_doc_arena_acquire(arena), first);
+            assert_eq!(zvec_bindings::ffi::zvec_doc_arena_acquire(arena), second);
+            zvec_bindings::ffi::zvec_doc_arena_free(arena);
+        }
+
+        Ok(())
+    }
+
     #[test]
     fn test_field_schema_constructors() {
         let fs = FieldSchema::bool_("bool_field");
@@ -586,6 +704,26 @@ mod coverage_tests {
         Ok(())
     }
 
+    #[test]
+    fn test_columnar_batch_length_checks() -> zvec_bindings::Result<()> {
+        let batch = ColumnarBatch::new(&["a", "b"])?;
+        assert_eq!(batch.len(), 2);
+
+        let result = ColumnarBatch::new(&["a", "b"])?.with_vector("embedding", &[0.1; 6], 4);
+        assert!(matches!(
+            result,
+            Err(zvec_bindings::Error::DimensionMismatch {
+                expected: 8,
+                actual: 6
+            })
+        ));
+
+        let result = ColumnarBatch::new(&["a", "b"])?.with_int64("count", &[1]);
+        assert!(result.is_err());
+
+        Ok(())
+    }
+
     #[test]
     fn test_doc_has_and_has_value() -> zvec_bindings::Result<()> {
         let mut doc = Doc::id("test");
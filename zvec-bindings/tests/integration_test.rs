@@ -1,6 +1,7 @@
 use zvec_bindings::{
-    create_and_open, Collection, CollectionSchema, DataType, Doc, FieldSchema, GroupByVectorQuery,
-    IndexParams, MetricType, QuantizeType, VectorQuery, VectorSchema,
+    create_and_open, CancelToken, Collection, CollectionOptions, CollectionSchema, ColumnarBatch,
+    DataType, Doc, FieldSchema, FlatColumn, GroupByVectorQuery, IndexParams, MetricType, Operator,
+    QuantizeType, RrfReRanker, VectorQuery, VectorSchema, WeightedReRanker,
 };
 
 #[cfg(test)]
@@ -38,6 +39,25 @@ mod integration_tests {
         tempfile::tempdir().map_err(|e| zvec_bindings::Error::InternalError(e.to_string()))
     }
 
+    fn block_on<F: std::future::Future>(future: F) -> F::Output {
+        struct ThreadWaker(std::thread::Thread);
+        impl std::task::Wake for ThreadWaker {
+            fn wake(self: std::sync::Arc<Self>) {
+                self.0.unpark();
+            }
+        }
+
+        let waker = std::sync::Arc::new(ThreadWaker(std::thread::current())).into();
+        let mut cx = std::task::Context::from_waker(&waker);
+        let mut future = std::pin::pin!(future);
+        loop {
+            if let std::task::Poll::Ready(output) = future.as_mut().poll(&mut cx) {
+                return output;
+            }
+            std::thread::park();
+        }
+    }
+
     fn create_test_collection(path: &std::path::Path) -> zvec_bindings::Result<Collection> {
         let mut schema = CollectionSchema::new("test");
         schema.add_field(VectorSchema::fp32("embedding", 4).into())?;
@@ -177,6 +197,371 @@ mod integration_tests {
         Ok(())
     }
 
+    #[test]
+    fn test_collection_async_writes() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        let first =
+            collection.insert_async(&[Doc::id("async_1").with_vector("embedding", &[1.0; 4])?]);
+        let second = collection.upsert_async(&[
+            Doc::id("async_1").with_vector("embedding", &[2.0; 4])?,
+            Doc::id("async_2").with_vector("embedding", &[3.0; 4])?,
+        ]);
+        assert!(second.ticket() > first.ticket());
+
+        let results = block_on(second)?;
+        assert_eq!(results.len(), 2);
+        assert!(results.iter().all(|r| r.is_ok()));
+        assert!(block_on(first)?.get(0).unwrap().is_ok());
+
+        let fetched = collection.fetch(&["async_1"])?;
+        assert_eq!(
+            fetched.get("async_1").unwrap().get_vector("embedding"),
+            Some(vec![2.0; 4])
+        );
+
+        assert!(block_on(collection.insert_async(&[])).is_err());
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_bulk_writer() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        let mut writer = collection.bulk_writer(Operator::Insert, 2)?;
+        for i in 0..5 {
+            writer
+                .add(&Doc::id(format!("bulk_{}", i)).with_vector("embedding", &[i as f32; 4])?)?;
+        }
+        writer.add_all(&[Doc::id("bulk_0").with_vector("embedding", &[0.0; 4])?])?;
+        let summary = writer.finish()?;
+        assert_eq!(summary.len(), 6);
+        assert_eq!(summary.success_count(), 5);
+        assert!(summary.is_failed(5));
+
+        let fetched = collection.fetch(&["bulk_0", "bulk_4"])?;
+        assert_eq!(fetched.len(), 2);
+        assert_eq!(
+            fetched.get("bulk_4").unwrap().get_vector("embedding"),
+            Some(vec![4.0; 4])
+        );
+
+        assert!(collection.bulk_writer(Operator::Delete, 2).is_err());
+        assert!(collection.bulk_writer(Operator::Upsert, 0).is_err());
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_write_summary() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        let docs = (0..3)
+            .map(|i| Doc::id(format!("summary_{}", i)).with_vector("embedding", &[i as f32; 4]))
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        let summary = collection.insert_summary(&docs)?;
+        assert_eq!(summary.len(), 3);
+        assert_eq!(summary.success_count(), 3);
+        assert!(summary.all_ok());
+        assert_eq!(summary.failures().count(), 0);
+
+        let docs = vec![
+            Doc::id("summary_1").with_vector("embedding", &[1.0; 4])?,
+            Doc::id("summary_3").with_vector("embedding", &[3.0; 4])?,
+        ];
+        let summary = collection.insert_summary(&docs)?;
+        assert_eq!(summary.failure_count(), 1);
+        assert!(summary.is_failed(0));
+        assert!(!summary.is_failed(1));
+        assert!(matches!(
+            summary.get(0),
+            Some(Err(zvec_bindings::Error::AlreadyExists(_)))
+        ));
+        assert_eq!(
+            summary.iter().map(|r| r.is_ok()).collect::<Vec<_>>(),
+            vec![false, true]
+        );
+
+        let summary = collection.delete_summary(&["summary_0", "summary_3"])?;
+        assert!(summary.all_ok());
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_owned_writes() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        let docs = (0..3)
+            .map(|i| Doc::id(format!("owned_{}", i)).with_vector("embedding", &[i as f32; 4]))
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        let results = collection.insert_owned(docs)?;
+        assert_eq!(results.len(), 3);
+        assert!(results.iter().all(|r| r.is_ok()));
+
+        let doc = Doc::id("owned_1").with_vector("embedding", &[9.0; 4])?;
+        let results = collection.upsert_owned(vec![doc])?;
+        assert!(results.get(0).unwrap().is_ok());
+
+        let doc = Doc::id("owned_2").with_vector("embedding", &[7.0; 4])?;
+        let results = collection.update_owned(vec![doc])?;
+        assert!(results.get(0).unwrap().is_ok());
+
+        let fetched = collection.fetch(&["owned_1", "owned_2"])?;
+        assert_eq!(
+            fetched.get("owned_1").unwrap().get_vector("embedding"),
+            Some(vec![9.0; 4])
+        );
+        assert_eq!(
+            fetched.get("owned_2").unwrap().get_vector("embedding"),
+            Some(vec![7.0; 4])
+        );
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_query_batch() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        let docs = (0..8)
+            .map(|i| Doc::id(format!("batch_{}", i)).with_vector("embedding", &[i as f32; 4]))
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        collection.insert(&docs)?;
+
+        let template = VectorQuery::new("embedding").topk(3);
+        let vectors: Vec<f32> = [1.0f32, 5.0, 7.0].iter().flat_map(|&v| [v; 4]).collect();
+        let batch = collection.query_batch(&template, &vectors, 4)?;
+        assert_eq!(batch.len(), 3);
+
+        for (row, results) in vectors.chunks(4).zip(&batch) {
+            let single = collection.query(VectorQuery::new("embedding").topk(3).vector(row)?)?;
+            let expected: Vec<String> = single.iter().map(|d| d.pk().to_string()).collect();
+            let actual: Vec<String> = results.iter().map(|d| d.pk().to_string()).collect();
+            assert_eq!(actual, expected);
+        }
+
+        assert!(collection.query_batch(&template, &vectors, 5).is_err());
+        assert!(collection.query_batch(&template, &vectors[..8], 2).is_err());
+
+        let reranked = || VectorQuery::new("embedding").topk(3).rerank(2);
+        let batch = collection.query_batch(&reranked(), &vectors, 4)?;
+        for (row, results) in vectors.chunks(4).zip(&batch) {
+            let single = collection.query(reranked().vector(row)?)?;
+            assert_eq!(results.len(), single.len());
+            for (a, b) in results.iter().zip(single.iter()) {
+                assert_eq!(a.pk(), b.pk());
+                assert_eq!(a.score(), b.score());
+            }
+        }
+
+        let by_pk = VectorQuery::new("embedding").id("batch_0");
+        assert!(collection.query_batch(&by_pk, &vectors, 4).is_err());
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_insert_columnar() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+
+        let mut schema = CollectionSchema::new("test");
+        schema.add_field(VectorSchema::fp32("embedding", 4).into())?;
+        schema.add_field(FieldSchema::int64("count"))?;
+        schema.add_field(FieldSchema::string("name"))?;
+        let collection = create_and_open(&path, schema)?;
+
+        let vectors = [
+            1.0, 0.0, 0.0, 0.0, //
+            0.0, 1.0, 0.0, 0.0, //
+            0.0, 0.0, 1.0, 0.0,
+        ];
+        let batch = ColumnarBatch::new(&["col_1", "col_2", "col_3"])?
+            .with_vector("embedding", &vectors, 4)?
+            .with_int64("count", &[10, 20, 30])?
+            .with_string("name", &["a", "b", "c"])?;
+        let results = collection.insert_columnar(&batch)?;
+        assert_eq!(results.len(), 3);
+        assert!(results.iter().all(|r| r.is_ok()));
+
+        let fetched = collection.fetch(&["col_2"])?;
+        let doc = fetched.get("col_2").expect("Document should exist");
+        assert_eq!(doc.get_int64("count"), Some(20));
+        assert_eq!(doc.get_string("name"), Some("b"));
+        assert_eq!(doc.get_vector("embedding"), Some(vec![0.0, 1.0, 0.0, 0.0]));
+
+        let batch = ColumnarBatch::new(&["col_1", "col_4"])?
+            .with_vector("embedding", &vectors[..8], 4)?
+            .with_int64("count", &[11, 40])?;
+        let results = collection.upsert_columnar(&batch)?;
+        assert!(results.iter().all(|r| r.is_ok()));
+
+        let fetched = collection.fetch(&["col_1", "col_4"])?;
+        assert_eq!(fetched.get("col_1").unwrap().get_int64("count"), Some(11));
+        assert_eq!(fetched.get("col_4").unwrap().get_int64("count"), Some(40));
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_query_flat() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+
+        let mut schema = CollectionSchema::new("test");
+        schema.add_field(VectorSchema::fp32("embedding", 4).into())?;
+        schema.add_field(FieldSchema::int64("count"))?;
+        let collection = create_and_open(&path, schema)?;
+
+        let vectors = [
+            1.0, 0.0, 0.0, 0.0, //
+            0.0, 1.0, 0.0, 0.0, //
+            0.0, 0.0, 1.0, 0.0,
+        ];
+        let batch = ColumnarBatch::new(&["flat_1", "flat_2", "flat_3"])?
+            .with_vector("embedding", &vectors, 4)?
+            .with_int64("count", &[10, 20, 30])?;
+        collection.insert_columnar(&batch)?;
+
+        let query = || {
+            VectorQuery::new("embedding")
+                .topk(3)
+                .output_fields(&["count"])
+                .vector(&[0.0, 1.0, 0.0, 0.0])
+        };
+        let docs = collection.query(query()?)?;
+        let flat = collection.query_flat(query()?, &[("count", DataType::Int64)])?;
+        assert_eq!(flat.len(), docs.len());
+        assert_eq!(flat.scores().len(), flat.len());
+
+        let counts = match flat.column("count") {
+            Some(FlatColumn::Int64(values)) => values,
+            other => panic!("unexpected column {:?}", other),
+        };
+        for (i, doc) in docs.iter().enumerate() {
+            assert_eq!(flat.pk(i), Some(doc.pk()));
+            assert_eq!(flat.scores()[i], doc.score());
+            assert_eq!(Some(counts[i]), doc.get_int64("count"));
+        }
+        assert!(flat.column_valid("count").unwrap().iter().all(|&v| v));
+        assert!(flat.column("missing").is_none());
+
+        assert!(collection
+            .query_flat(query()?, &[("count", DataType::String)])
+            .is_err());
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_query_ids_only() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+
+        let mut schema = CollectionSchema::new("test");
+        schema.add_field(VectorSchema::fp32("embedding", 4).into())?;
+        schema.add_field(FieldSchema::int64("count"))?;
+        let collection = create_and_open(&path, schema)?;
+
+        let mut doc = Doc::id("ids_1").with_vector("embedding", &[1.0, 0.0, 0.0, 0.0])?;
+        doc.set_int64("count", 5)?;
+        collection.insert(&[doc])?;
+
+        let query = || VectorQuery::new("embedding").topk(1);
+        let full = collection.query(query().vector(&[1.0, 0.0, 0.0, 0.0])?)?;
+        assert_eq!(full.get(0).unwrap().get_int64("count"), Some(5));
+
+        let ids = collection.query(query().ids_only(true).vector(&[1.0, 0.0, 0.0, 0.0])?)?;
+        let hit = ids.get(0).unwrap();
+        assert_eq!(hit.pk(), "ids_1");
+        assert_eq!(hit.score(), full.get(0).unwrap().score());
+        assert_eq!(hit.get_int64("count"), None);
+        assert_eq!(hit.get_vector("embedding"), None);
+
+        let restored = collection.query(
+            query()
+                .ids_only(true)
+                .ids_only(false)
+                .vector(&[1.0, 0.0, 0.0, 0.0])?,
+        )?;
+        assert_eq!(restored.get(0).unwrap().get_int64("count"), Some(5));
+
+        let default = query();
+        let toggled = query().ids_only(true).ids_only(false);
+        assert!(query().ids_only(true).includes_doc_id());
+        assert_eq!(toggled.includes_doc_id(), default.includes_doc_id());
+        assert_eq!(toggled.includes_vector(), default.includes_vector());
+        let toggled = query().include_vector(true).ids_only(true).ids_only(false);
+        assert!(toggled.includes_vector());
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_prepared_query() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        let docs = (0..4)
+            .map(|i| {
+                let mut v = [0.0; 4];
+                v[i] = 1.0;
+                Doc::id(format!("prep_{}", i)).with_vector("embedding", &v)
+            })
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        collection.insert(&docs)?;
+
+        let mut prepared = collection.prepare(VectorQuery::new("embedding").topk(1))?;
+        assert_eq!(prepared.dimension(), 4);
+        for i in 0..4 {
+            let mut v = [0.0; 4];
+            v[i] = 1.0;
+            prepared.set_vector(&v)?;
+            let results = collection.query_prepared(&prepared)?;
+            assert_eq!(results.get(0).unwrap().pk(), format!("prep_{}", i));
+        }
+        assert!(prepared.set_vector(&[1.0; 3]).is_err());
+
+        assert!(collection.prepare(VectorQuery::new("missing")).is_err());
+        assert!(collection
+            .prepare(VectorQuery::new("embedding").output_fields(&["missing"]))
+            .is_err());
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_prepared_sparse_query() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let mut schema = CollectionSchema::new("test");
+        schema.add_field(VectorSchema::fp32("embedding", 4).into())?;
+        schema.add_field(VectorSchema::sparse_fp32("terms").into())?;
+        let collection = create_and_open(&path, schema)?;
+
+        let query = VectorQuery::new("terms").sparse_vector(&[1, 7], &[0.5, 0.25])?;
+        let mut prepared = collection.prepare(query)?;
+        assert_eq!(prepared.dimension(), 0);
+        assert!(prepared.set_vector(&[1.0]).is_err());
+        assert!(collection.query_prepared(&prepared)?.is_empty());
+        assert!(collection.prepare(VectorQuery::new("missing")).is_err());
+
+        Ok(())
+    }
+
     #[test]
     fn test_collection_scalar_fields() -> zvec_bindings::Result<()> {
         let dir = tempdir()?;
@@ -305,6 +690,21 @@ mod integration_tests {
         let results = collection.group_by_query(query)?;
         assert!(!results.is_empty());
 
+        // Groups share the engine's results: values and docs stay readable
+        // for as long as the results, however often they are read.
+        let mut seen = Vec::new();
+        for _ in 0..2 {
+            for group in results.iter() {
+                for doc in group.docs().iter() {
+                    assert_eq!(doc.get_string("category"), Some(group.group_by_value()));
+                    seen.push(doc.pk().to_string());
+                }
+            }
+        }
+        seen.sort();
+        assert_eq!(seen, ["doc_1", "doc_1", "doc_2", "doc_2", "doc_3", "doc_3"]);
+        assert_eq!(results.stats().hit_count, 3);
+
         Ok(())
     }
 
@@ -332,4 +732,426 @@ mod integration_tests {
 
         Ok(())
     }
+
+    #[test]
+    fn test_collection_query_deadline_and_cancel() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        let doc = Doc::id("bounded_1").with_vector("embedding", &[1.0; 4])?;
+        collection.insert(&[doc])?;
+
+        let query = VectorQuery::new("embedding")
+            .timeout(std::time::Duration::from_secs(60))
+            .vector(&[1.0; 4])?;
+        let (results, truncated) = collection.query_bounded(query)?;
+        assert!(!truncated);
+        assert_eq!(results.len(), 1);
+
+        let token = CancelToken::new();
+        let query = || VectorQuery::new("embedding").cancel_token(&token);
+        let (results, truncated) = collection.query_bounded(query().vector(&[1.0; 4])?)?;
+        assert!(!truncated);
+        assert_eq!(results.len(), 1);
+
+        token.cancel();
+        assert!(token.is_cancelled());
+        let (results, truncated) = collection.query_bounded(query().vector(&[1.0; 4])?)?;
+        assert!(truncated);
+        assert!(results.is_empty());
+
+        let (lists, truncated) = collection.query_batch_bounded(&query(), &[1.0; 8], 4)?;
+        assert!(truncated);
+        assert!(lists.iter().all(|l| l.is_empty()));
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_query_stats() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        let docs = (0..5)
+            .map(|i| Doc::id(format!("stats_{}", i)).with_vector("embedding", &[i as f32; 4]))
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        collection.insert(&docs)?;
+
+        let results = collection.query(VectorQuery::new("embedding").topk(3).vector(&[1.0; 4])?)?;
+        let stats = results.stats();
+        assert_eq!(stats.hit_count, results.len());
+        assert!(stats.search > std::time::Duration::ZERO);
+        assert!(!stats.truncated);
+
+        let batch = collection.query_batch(&VectorQuery::new("embedding").topk(2), &[1.0; 8], 4)?;
+        assert!(batch.iter().all(|l| l.stats().hit_count == l.len()));
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_query_by_id() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        // Unit vectors, so the source is its own nearest neighbour under any metric.
+        let unit = |i: usize| {
+            let angle = i as f32 * 0.3;
+            [angle.cos(), angle.sin(), 0.0, 0.0]
+        };
+        let docs = (0..6)
+            .map(|i| Doc::id(format!("like_{}", i)).with_vector("embedding", &unit(i)))
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        collection.insert(&docs)?;
+
+        let results = collection.query(VectorQuery::new("embedding").topk(3).id("like_2"))?;
+        let by_vector =
+            collection.query(VectorQuery::new("embedding").topk(3).vector(&unit(2))?)?;
+        let pks: Vec<String> = results.iter().map(|d| d.pk().to_string()).collect();
+        let expected: Vec<String> = by_vector.iter().map(|d| d.pk().to_string()).collect();
+        assert_eq!(pks, expected);
+        assert_eq!(pks[0], "like_2");
+
+        let results = collection.query(
+            VectorQuery::new("embedding")
+                .topk(3)
+                .id("like_2")
+                .exclude_source(true),
+        )?;
+        assert_eq!(results.len(), 3);
+        assert!(results.iter().all(|d| d.pk() != "like_2"));
+
+        // Every doc is in the radius, so the cap still counts other docs only.
+        let results = collection.query(
+            VectorQuery::new("embedding")
+                .id("like_2")
+                .exclude_source(true)
+                .range(-2.0, 3)?,
+        )?;
+        assert_eq!(results.len(), 3);
+        assert!(results.iter().all(|d| d.pk() != "like_2"));
+
+        assert!(collection
+            .query(VectorQuery::new("embedding").id("missing"))
+            .is_err());
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_range_query() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        let docs = (0..30)
+            .map(|i| Doc::id(format!("range_{}", i)).with_vector("embedding", &[i as f32; 4]))
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        collection.insert(&docs)?;
+
+        // Inner product with [1; 4] scores doc i at 4 * i.
+        let query = || VectorQuery::new("embedding").topk(4).vector(&[1.0; 4]);
+        let results = collection.query(query()?.range(40.0, 100)?)?;
+        assert_eq!(results.len(), 20);
+        assert!(results.iter().all(|d| d.score() >= 40.0));
+
+        let results = collection.query(query()?.range(40.0, 5)?)?;
+        assert_eq!(results.len(), 5);
+
+        let results = collection.query(query()?.range(1000.0, 100)?)?;
+        assert!(results.is_empty());
+
+        let results = collection.query(query()?.range(40.0, 100)?.rerank(4))?;
+        assert_eq!(results.len(), 20);
+        assert!(results.iter().all(|d| d.score() >= 40.0));
+
+        assert!(query()?.range(40.0, 0).is_err());
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_query_rerank() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        let docs = (0..20)
+            .map(|i| {
+                let x = i as f32 / 10.0;
+                Doc::id(format!("rerank_{}", i)).with_vector("embedding", &[x, 1.0 - x, x * x, 0.5])
+            })
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        collection.insert(&docs)?;
+
+        // Reranking scores with the index metric, so it matches the plain
+        // query before and after the field is indexed with L2.
+        let query = [0.3, 0.2, 0.9, 0.1];
+        for index in [None, Some(MetricType::L2)] {
+            if let Some(metric) = index {
+                let params = IndexParams::flat(metric, QuantizeType::Undefined);
+                collection.create_index("embedding", params)?;
+            }
+            let plain = collection.query(VectorQuery::new("embedding").topk(5).vector(&query)?)?;
+            for include_vector in [false, true] {
+                let reranked = collection.query(
+                    VectorQuery::new("embedding")
+                        .topk(5)
+                        .include_vector(include_vector)
+                        .rerank(4)
+                        .vector(&query)?,
+                )?;
+                assert_eq!(reranked.len(), 5);
+                for (a, b) in plain.iter().zip(reranked.iter()) {
+                    assert_eq!(a.pk(), b.pk());
+                    assert!((a.score() - b.score()).abs() < 1e-5);
+                }
+            }
+        }
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_search_iter() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        let docs = (0..25)
+            .map(|i| Doc::id(format!("page_{}", i)).with_vector("embedding", &[i as f32; 4]))
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        collection.insert(&docs)?;
+
+        let query = VectorQuery::new("embedding").vector(&[1.0; 4])?;
+        let pages = collection
+            .search_iter(&query, 10)?
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        let sizes: Vec<usize> = pages.iter().map(|p| p.len()).collect();
+        assert_eq!(sizes, vec![10, 10, 5]);
+
+        let paged: Vec<String> = pages
+            .iter()
+            .flat_map(|p| p.iter().map(|d| d.pk().to_string()).collect::<Vec<_>>())
+            .collect();
+        let all = collection.query(VectorQuery::new("embedding").topk(25).vector(&[1.0; 4])?)?;
+        let expected: Vec<String> = all.iter().map(|d| d.pk().to_string()).collect();
+        assert_eq!(paged, expected);
+
+        let mut iter = collection.search_iter(&query, 10)?;
+        assert_eq!(iter.next_batch(3)?.len(), 3);
+        assert_eq!(iter.next_batch(30)?.len(), 22);
+        assert!(iter.next_batch(1)?.is_empty());
+
+        let token = CancelToken::new();
+        token.cancel();
+        let cancelled = VectorQuery::new("embedding")
+            .cancel_token(&token)
+            .vector(&[1.0; 4])?;
+        let pages: Vec<_> = collection.search_iter(&cancelled, 10)?.take(5).collect();
+        assert_eq!(pages.len(), 1);
+        assert!(pages[0].is_err());
+
+        let mut iter = collection.search_iter(&cancelled, 10)?;
+        let page = iter.next_batch(10)?;
+        assert!(page.is_empty() && page.stats().truncated);
+        let page = iter.next_batch(10)?;
+        assert!(page.is_empty() && !page.stats().truncated);
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_hybrid_query() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+
+        let mut schema = CollectionSchema::new("test");
+        schema.add_field(VectorSchema::fp32("dense", 4).into())?;
+        schema.add_field(VectorSchema::fp32("title", 4).into())?;
+        let collection = create_and_open(&path, schema)?;
+
+        let docs = (0..8)
+            .map(|i| {
+                Doc::id(format!("hybrid_{}", i))
+                    .with_vector("dense", &[i as f32; 4])?
+                    .with_vector("title", &[(7 - i) as f32; 4])
+            })
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        collection.insert(&docs)?;
+
+        let queries = || -> zvec_bindings::Result<Vec<VectorQuery>> {
+            Ok(vec![
+                VectorQuery::new("dense").topk(4).vector(&[2.0; 4])?,
+                VectorQuery::new("title").topk(4).vector(&[-1.0; 4])?,
+            ])
+        };
+        let separate = |queries: Vec<VectorQuery>| -> zvec_bindings::Result<_> {
+            let mut results = std::collections::HashMap::new();
+            for query in queries {
+                let field = query.field_name().to_string();
+                let hits = collection.query(query)?;
+                let hits: Vec<(String, f32)> = hits
+                    .iter()
+                    .map(|d| (d.pk().to_string(), d.score()))
+                    .collect();
+                results.insert(field, hits);
+            }
+            Ok(results)
+        };
+        let score_of = |expected: &[(String, f32)], pk: &str| {
+            expected.iter().find(|(id, _)| id == pk).map(|(_, s)| *s)
+        };
+
+        let rrf = RrfReRanker::new(3);
+        let fused = collection.hybrid_query_rrf(&queries()?, &rrf)?;
+        let expected = RrfReRanker::new(usize::MAX).rerank(&separate(queries()?)?);
+        assert_eq!(fused.len(), 3);
+        assert!((fused.get(0).unwrap().score() - expected[0].1).abs() < 1e-6);
+        for doc in fused.iter() {
+            let expected_score = score_of(&expected, doc.pk()).unwrap();
+            assert!((doc.score() - expected_score).abs() < 1e-6);
+        }
+
+        // Weighted fusion normalizes each query for its own field's metric.
+        let flat = |metric| IndexParams::flat(metric, QuantizeType::Undefined);
+        collection.create_index("dense", flat(MetricType::L2))?;
+        collection.create_index("title", flat(MetricType::Ip))?;
+        let weighted = WeightedReRanker::new(5, MetricType::Undefined).with_weight("title", 0.25);
+        let fused = collection.hybrid_query_weighted(&queries()?, &weighted)?;
+        let mut separate = separate(queries()?)?;
+        let title = separate.remove("title").unwrap();
+        let dense = WeightedReRanker::new(usize::MAX, MetricType::L2).rerank(&separate);
+        let title = WeightedReRanker::new(usize::MAX, MetricType::Ip)
+            .with_weight("title", 0.25)
+            .rerank(&std::collections::HashMap::from([("title", title)]));
+        assert_eq!(fused.len(), 5);
+        let scores: Vec<f32> = fused.iter().map(|d| d.score()).collect();
+        assert!(scores.windows(2).all(|w| w[0] >= w[1]));
+        for doc in fused.iter() {
+            let expected_score = score_of(&dense, doc.pk()).unwrap_or(0.0)
+                + score_of(&title, doc.pk()).unwrap_or(0.0);
+            assert!((doc.score() - expected_score).abs() < 1e-5);
+        }
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_result_cache() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let mut schema = CollectionSchema::new("test");
+        schema.add_field(VectorSchema::fp32("embedding", 4).into())?;
+        let options = CollectionOptions::new().result_cache_capacity(16);
+        let collection = Collection::create_and_open_with_options(&path, schema, &options)?;
+
+        let docs = (0..4)
+            .map(|i| {
+                let mut vector = [0.0; 4];
+                vector[i] = 1.0;
+                Doc::id(format!("cached_{}", i)).with_vector("embedding", &vector)
+            })
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        collection.insert(&docs)?;
+
+        let query = || {
+            VectorQuery::new("embedding")
+                .topk(2)
+                .vector(&[0.6, 0.8, 0.0, 0.0])
+        };
+        let pks = |results: &zvec_bindings::doc::DocList| -> Vec<String> {
+            results.iter().map(|d| d.pk().to_string()).collect()
+        };
+        let first = collection.query(query()?)?;
+        let repeated = collection.query(query()?)?;
+        assert_eq!(pks(&first), vec!["cached_1", "cached_0"]);
+        assert_eq!(pks(&first), pks(&repeated));
+        let scores = |results: &zvec_bindings::doc::DocList| -> Vec<f32> {
+            results.iter().map(|d| d.score()).collect()
+        };
+        assert_eq!(scores(&first), scores(&repeated));
+        let other = collection.query(query()?.topk(3))?;
+        assert_eq!(other.len(), 3);
+        let tuned = collection.query(query()?.hnsw_params(64))?;
+        assert_eq!(pks(&tuned), pks(&first));
+
+        collection
+            .insert(&[Doc::id("cached_new").with_vector("embedding", &[0.6, 0.8, 0.0, 0.0])?])?;
+        let after_write = collection.query(query()?)?;
+        assert_eq!(pks(&after_write), vec!["cached_new", "cached_1"]);
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_doc_vector_view() -> zvec_bindings::Result<()> {
+        let mut doc = Doc::id("view_1").with_vector("embedding", &[1.0, 2.0, 3.0, 4.0])?;
+        assert_eq!(
+            doc.get_vector_view("embedding"),
+            Some(&[1.0, 2.0, 3.0, 4.0][..])
+        );
+        doc.set_vector("embedding", &[4.0, 3.0, 2.0, 1.0])?;
+        assert_eq!(
+            doc.get_vector_view("embedding"),
+            Some(&[4.0, 3.0, 2.0, 1.0][..])
+        );
+        doc.set_vector_fp16("half", &[1.0, 2.0])?;
+        assert_eq!(doc.get_vector_view("half"), None);
+        assert_eq!(doc.get_vector_view("missing"), None);
+
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+        let doc2 = Doc::id("view_2").with_vector("embedding", &[0.0, 1.0, 0.0, 0.0])?;
+        collection.insert(&[doc, doc2])?;
+
+        let fetched = collection.fetch(&["view_1", "view_2"])?;
+        let first = fetched
+            .get("view_1")
+            .unwrap()
+            .get_vector_view("embedding")
+            .unwrap();
+        let second = fetched
+            .get("view_2")
+            .unwrap()
+            .get_vector_view("embedding")
+            .unwrap();
+        assert_eq!(first, &[4.0, 3.0, 2.0, 1.0]);
+        assert_eq!(second, &[0.0, 1.0, 0.0, 0.0]);
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_collection_fetch_vectors_into() -> zvec_bindings::Result<()> {
+        let dir = tempdir()?;
+        let path = dir.path().join("test_db");
+        let collection = create_test_collection(&path)?;
+
+        let docs = (0..3)
+            .map(|i| Doc::id(format!("rows_{}", i)).with_vector("embedding", &[i as f32 + 1.0; 4]))
+            .collect::<zvec_bindings::Result<Vec<_>>>()?;
+        collection.insert(&docs)?;
+
+        let mut out = vec![-1.0f32; 12];
+        let found = collection.fetch_vectors_into(
+            &["rows_2", "missing", "rows_0"],
+            "embedding",
+            4,
+            &mut out,
+        )?;
+        assert_eq!(found, vec![true, false, true]);
+        assert_eq!(&out[..4], &[3.0; 4]);
+        assert_eq!(&out[4..8], &[0.0; 4]);
+        assert_eq!(&out[8..], &[1.0; 4]);
+        assert!(collection
+            .fetch_vectors_into(&["rows_0"], "embedding", 4, &mut out)
+            .is_err());
+
+        Ok(())
+    }
 }
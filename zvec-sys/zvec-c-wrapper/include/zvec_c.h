@@ -32,6 +32,10 @@ typedef struct zvec_collection_options zvec_collection_options_t;
 typedef struct zvec_create_index_options zvec_create_index_options_t;
 typedef struct zvec_optimize_options zvec_optimize_options_t;
 typedef struct zvec_collection_stats zvec_collection_stats_t;
+typedef struct zvec_bulk_writer zvec_bulk_writer_t;
+typedef struct zvec_doc_arena zvec_doc_arena_t;
+typedef struct zvec_cancel_token zvec_cancel_token_t;
+typedef struct zvec_search_iterator zvec_search_iterator_t;
 
 /* ============================================================================
  * Enums
@@ -49,6 +53,11 @@ typedef enum zvec_status_code {
     ZVEC_STATUS_UNKNOWN = 8
 } zvec_status_code_t;
 
+typedef enum zvec_fusion_type {
+    ZVEC_FUSION_RRF = 0,
+    ZVEC_FUSION_WEIGHTED = 1
+} zvec_fusion_type_t;
+
 typedef enum zvec_data_type {
     ZVEC_DATA_TYPE_UNDEFINED = 0,
     ZVEC_DATA_TYPE_BINARY = 1,
@@ -155,6 +164,13 @@ void zvec_collection_options_free(zvec_collection_options_t* options);
 void zvec_collection_options_set_read_only(zvec_collection_options_t* options, bool read_only);
 void zvec_collection_options_set_enable_mmap(zvec_collection_options_t* options, bool enable_mmap);
 void zvec_collection_options_set_max_buffer_size(zvec_collection_options_t* options, uint64_t max_buffer_size);
+/* Caches up to `capacity` query results per opened collection handle (0, the
+ * default, disables it). Any write, delete, optimize or schema change through
+ * the handle invalidates all cached results; changes made through another
+ * handle or process are not seen, so a handle sharing its collection with
+ * writers should leave the cache off. Cached docs are shared with the lists
+ * handed out; changing a doc from such a list copies it first. */
+void zvec_collection_options_set_result_cache_capacity(zvec_collection_options_t* options, size_t capacity);
 
 /* ============================================================================
  * Field Schema
@@ -235,6 +251,18 @@ void zvec_optimize_options_set_concurrency(zvec_optimize_options_t* options, int
 zvec_doc_t* zvec_doc_new(void);
 void zvec_doc_free(zvec_doc_t* doc);
 
+/* Clear pk, score, doc id and all fields, keeping the handle for reuse. */
+void zvec_doc_reset(zvec_doc_t* doc);
+
+/* A pool of reusable doc handles for ingest loops. Acquired docs are owned by
+ * the arena (zvec_doc_free on them is a no-op) and come back empty. After
+ * zvec_doc_arena_reset the same handles are handed out again in the same
+ * order, so a loop over fixed-size batches allocates no new handles. */
+zvec_doc_arena_t* zvec_doc_arena_new(size_t capacity);
+zvec_doc_t* zvec_doc_arena_acquire(zvec_doc_arena_t* arena);
+void zvec_doc_arena_reset(zvec_doc_arena_t* arena);
+void zvec_doc_arena_free(zvec_doc_arena_t* arena);
+
 void zvec_doc_set_pk(zvec_doc_t* doc, const char* pk);
 const char* zvec_doc_pk(const zvec_doc_t* doc);
 
@@ -263,6 +291,14 @@ zvec_status_t zvec_doc_set_vector_int16(zvec_doc_t* doc, const char* field, cons
 zvec_status_t zvec_doc_set_vector_int32(zvec_doc_t* doc, const char* field, const int32_t* data, size_t len);
 zvec_status_t zvec_doc_set_vector_int64(zvec_doc_t* doc, const char* field, const int64_t* data, size_t len);
 
+/* Quantizing vector setters: convert fp32 input while storing it. int8/int4
+ * store round(x / scale), ties to even, clamped to [-128, 127] / [-8, 7],
+ * and NaN as -128 / -8; int4 values are packed two per byte, low nibble
+ * first. `scale` must be positive. */
+zvec_status_t zvec_doc_set_vector_fp16_from_fp32(zvec_doc_t* doc, const char* field, const float* data, size_t len);
+zvec_status_t zvec_doc_set_vector_int8_from_fp32(zvec_doc_t* doc, const char* field, const float* data, size_t len, float scale);
+zvec_status_t zvec_doc_set_vector_int4_from_fp32(zvec_doc_t* doc, const char* field, const float* data, size_t len, float scale);
+
 /* Sparse vector setter */
 zvec_status_t zvec_doc_set_sparse_vector_fp32(zvec_doc_t* doc, const char* field,
     const uint32_t* indices, size_t indices_count, const float* values, size_t values_count);
@@ -285,12 +321,47 @@ bool zvec_doc_get_string(const zvec_doc_t* doc, const char* field, const char**
 /* Vector getters - returns length, or 0 if not found */
 size_t zvec_doc_get_vector_fp32(const zvec_doc_t* doc, const char* field, float* out_data, size_t max_len);
 
+/* Cached getter for a dense vector field. The engine hands out field values
+ * by copy only, so the first call for a field copies it into a buffer owned
+ * by the doc handle and later calls return that buffer; this is not a view
+ * of the doc's own storage. `data` points to `len` elements of `data_type`
+ * (int4 vectors report VECTOR_INT8, packed two per byte) and stays valid
+ * until the doc is modified, reset or freed, which also drops the buffers.
+ * Until then the handle holds one buffer per field read this way. */
+typedef struct zvec_vector_view {
+    const void* data;
+    size_t len;
+    zvec_data_type_t data_type;
+} zvec_vector_view_t;
+
+bool zvec_doc_get_vector_view(const zvec_doc_t* doc, const char* field, zvec_vector_view_t* out_view);
+
 /* Field info */
 bool zvec_doc_has(const zvec_doc_t* doc, const char* field);
 bool zvec_doc_has_value(const zvec_doc_t* doc, const char* field);
 bool zvec_doc_is_null(const zvec_doc_t* doc, const char* field);
 zvec_string_array_t zvec_doc_field_names(const zvec_doc_t* doc);
 
+/* ============================================================================
+ * Query Stats
+ * ============================================================================ */
+
+/* Timing of one query execution, filled by the query calls and zeroed
+ * elsewhere. This is only a wall-time split between the engine call and the
+ * wrapper, plus the hit count; it is not a per-stage profile. The engine
+ * reports no breakdown of its search, so `search_ns` covers filter parsing
+ * and evaluation, index traversal, distance computation and field fetch
+ * together, and none of those stages can be timed on its own from here.
+ * `materialize_ns` is the time spent building the result handles.
+ * `truncated` is set when the query's timeout or cancel token cut it off,
+ * or it was refused because too many bounded searches were in flight. */
+typedef struct zvec_query_stats {
+    uint64_t search_ns;
+    uint64_t materialize_ns;
+    size_t hit_count;
+    bool truncated;
+} zvec_query_stats_t;
+
 /* ============================================================================
  * Doc List (for returning query results)
  * ============================================================================ */
@@ -298,6 +369,7 @@ zvec_string_array_t zvec_doc_field_names(const zvec_doc_t* doc);
 typedef struct zvec_doc_list {
     zvec_doc_t** docs;
     size_t count;
+    zvec_query_stats_t stats;
 } zvec_doc_list_t;
 
 void zvec_doc_list_free(zvec_doc_list_t* list);
@@ -313,6 +385,86 @@ typedef struct zvec_write_results {
 
 void zvec_write_results_free(zvec_write_results_t* results);
 
+/* Compact form of write results. Allocates nothing when every document
+ * succeeds; otherwise one bitmap, plus an index and one byte of code per
+ * failed document. Bit i of `failed_bitmap` (LSB first) is set when document
+ * i failed. The failed documents' indices and codes are stored in
+ * `failed_indices` and `failed_codes`, `failure_count` entries each, in
+ * ascending document order. `messages` holds the first message reported for
+ * each status code. */
+typedef struct zvec_write_summary {
+    size_t count;
+    size_t success_count;
+    uint8_t* failed_bitmap;
+    size_t failure_count;
+    size_t* failed_indices;
+    uint8_t* failed_codes;
+    char* messages[ZVEC_STATUS_UNKNOWN + 1];
+} zvec_write_summary_t;
+
+void zvec_write_summary_free(zvec_write_summary_t* summary);
+
+/* ============================================================================
+ * Columnar Batch Input (for insert_columnar/upsert_columnar)
+ * ============================================================================ */
+
+/* A scalar column of a columnar batch. `data` points to `count` values whose
+ * C type matches `data_type`: bool, int32_t, int64_t, uint32_t, uint64_t,
+ * float, double, or const char* for ZVEC_DATA_TYPE_STRING (a NULL entry
+ * stores a null value). */
+typedef struct zvec_column {
+    const char* name;
+    zvec_data_type_t data_type;
+    const void* data;
+} zvec_column_t;
+
+/* ============================================================================
+ * Flat Query Results (for query_flat)
+ * ============================================================================ */
+
+/* A scalar field of flat query results. `data` holds one value per hit in the
+ * C type matching `data_type` (as for zvec_column_t; strings are not
+ * supported) and `valid[i]` is false where hit i has no value. */
+typedef struct zvec_flat_column {
+    char* name;
+    zvec_data_type_t data_type;
+    void* data;
+    bool* valid;
+} zvec_flat_column_t;
+
+/* Query hits as parallel arrays, one entry per hit in rank order. The pk of
+ * hit i is the `pk_offsets[i + 1] - pk_offsets[i]` bytes at
+ * `pk_data + pk_offsets[i]`; `pk_offsets` has `count + 1` entries. `doc_ids`
+ * are only meaningful when the query includes doc ids. */
+typedef struct zvec_flat_results {
+    size_t count;
+    char* pk_data;
+    size_t* pk_offsets;
+    float* scores;
+    uint64_t* doc_ids;
+    zvec_flat_column_t* columns;
+    size_t column_count;
+} zvec_flat_results_t;
+
+void zvec_flat_results_free(zvec_flat_results_t* results);
+
+/* ============================================================================
+ * Hybrid Query Fusion (for hybrid_query)
+ * ============================================================================ */
+
+/* How the sub-query results of a hybrid query are combined. RRF scores a doc
+ * by the sum of 1 / (rank_constant + rank + 1) over the sub-queries that
+ * returned it; WEIGHTED by the sum of weights[i] times its sub-query score
+ * normalized to [0, 1] for the metric of that sub-query's field index, read
+ * from the schema. `weights` has one entry per sub-query; NULL weighs every
+ * sub-query 1.0. */
+typedef struct zvec_fusion_params {
+    zvec_fusion_type_t kind;
+    size_t topn;
+    int rank_constant;
+    const double* weights;
+} zvec_fusion_params_t;
+
 /* ============================================================================
  * Doc Map (for fetch results)
  * ============================================================================ */
@@ -325,6 +477,17 @@ typedef struct zvec_doc_map {
 
 void zvec_doc_map_free(zvec_doc_map_t* map);
 
+/* ============================================================================
+ * Cancel Token
+ * ============================================================================ */
+
+/* A flag shared by the queries it is attached to; cancelling is safe from
+ * any thread and cannot be undone. */
+zvec_cancel_token_t* zvec_cancel_token_new(void);
+void zvec_cancel_token_cancel(zvec_cancel_token_t* token);
+bool zvec_cancel_token_is_cancelled(const zvec_cancel_token_t* token);
+void zvec_cancel_token_free(zvec_cancel_token_t* token);
+
 /* ============================================================================
  * Vector Query
  * ============================================================================ */
@@ -338,9 +501,62 @@ void zvec_vector_query_set_include_vector(zvec_vector_query_t* query, bool inclu
 void zvec_vector_query_set_include_doc_id(zvec_vector_query_t* query, bool include);
 void zvec_vector_query_set_output_fields(zvec_vector_query_t* query, const char** fields, size_t count);
 void zvec_vector_query_set_query_params(zvec_vector_query_t* query, zvec_query_params_t* params);
+/* Return only pk, doc id and score per hit: no output fields and no vector,
+ * so the engine does not read the forward store. Disabling restores the
+ * output fields, include_vector and include_doc_id in effect before it was
+ * enabled. */
+void zvec_vector_query_set_ids_only(zvec_vector_query_t* query, bool ids_only);
+bool zvec_vector_query_include_vector(const zvec_vector_query_t* query);
+bool zvec_vector_query_include_doc_id(const zvec_vector_query_t* query);
+
+
+const char* zvec_vector_query_field_name(const zvec_vector_query_t* query);
+
+/* Search with the vector stored in the query's field of an existing doc,
+ * addressed by pk. The vector is read inside the wrapper when the query runs;
+ * setting a vector afterwards replaces the source. */
+zvec_status_t zvec_vector_query_set_by_pk(zvec_vector_query_t* query, const char* pk);
+
+/* Drops the source doc of a by-pk query from its own results; topk, or
+ * max_results in range mode, still counts the other docs only. */
+void zvec_vector_query_set_exclude_source(zvec_vector_query_t* query, bool exclude);
+
+/* Radius filter: return the hits whose score is within `radius` among the
+ * best `max_results`, instead of a fixed topk. The direction follows the
+ * metric of the field's index, read from the schema: for IP, scores are
+ * similarities and hits score at least `radius`; for the distance metrics
+ * (L2, COSINE, MIPS_L2) they score at most `radius`. This is not a separate
+ * search mode: the engine takes no radius, so the query runs as an ordinary
+ * search with topk `max_results` and the wrapper drops the hits outside the
+ * radius. It costs the same as that search, and hits in the radius beyond
+ * the best `max_results` are never found. `max_results` must be positive. */
+zvec_status_t zvec_vector_query_set_range(zvec_vector_query_t* query, float radius, size_t max_results);
+
+/* Two-stage search for quantized indexes: fetch topk * factor candidates from
+ * the index, re-score them with their stored fp32 vectors and keep the best
+ * topk. Scores become exact values under the metric of the field's index,
+ * read from the schema: squared distance for L2, inner product for IP,
+ * 1 - cosine similarity for COSINE. In range mode every hit in the radius is
+ * re-scored instead, and hits whose exact score leaves it are dropped. Unless
+ * the query includes vectors, they are read with one fetch after the search;
+ * the query fails if that fetch does. A factor of 0 or 1 disables reranking;
+ * sparse queries are not reranked. */
+void zvec_vector_query_set_rerank(zvec_vector_query_t* query, uint32_t factor);
+
+/* Time budget for each execution of the query, in milliseconds (0, the
+ * default, means none). The caller stops waiting for a query still running
+ * when the budget is spent or its cancel token fires, and gets no hits; the
+ * search itself is not stopped. See zvec_collection_query_bounded. */
+void zvec_vector_query_set_timeout_ms(zvec_vector_query_t* query, uint64_t timeout_ms);
+/* Attaches `token` (NULL detaches); the query keeps its own reference. */
+void zvec_vector_query_set_cancel_token(zvec_vector_query_t* query, const zvec_cancel_token_t* token);
 
 /* Vector query input setters */
 zvec_status_t zvec_vector_query_set_vector_fp32(zvec_vector_query_t* query, const float* data, size_t len);
+/* Overwrites the vector of a query prepared with zvec_collection_prepare_query
+ * in place; `len` must equal the prepared field dimension. */
+zvec_status_t zvec_vector_query_update_vector_fp32(zvec_vector_query_t* query, const float* data, size_t len);
+
 zvec_status_t zvec_vector_query_set_sparse_vector_fp32(zvec_vector_query_t* query,
     const uint32_t* indices, size_t indices_count, const float* values, size_t values_count);
 
@@ -365,14 +581,20 @@ zvec_status_t zvec_group_by_vector_query_set_vector_fp32(zvec_group_by_vector_qu
  * Group Results
  * ============================================================================ */
 
+/* Group values and docs point into the engine's results, which `owner`
+ * keeps alive until zvec_group_results_free; nothing is copied per group.
+ * group_by_value used to be a separately allocated `char*`; it is now
+ * `const char*` and must be neither modified nor freed by the caller. */
 typedef struct zvec_group_result {
-    char* group_by_value;
+    const char* group_by_value;
     zvec_doc_list_t docs;
 } zvec_group_result_t;
 
 typedef struct zvec_group_results {
     zvec_group_result_t* groups;
     size_t count;
+    zvec_query_stats_t stats;
+    void* owner;
 } zvec_group_results_t;
 
 void zvec_group_results_free(zvec_group_results_t* results);
@@ -467,6 +689,55 @@ zvec_status_t zvec_collection_upsert(
     size_t count,
     zvec_write_results_t* out_results);
 
+/* Ownership-transferring writes: document contents are moved into the write
+ * instead of copied. On return every handle in `docs` has been freed and set
+ * to NULL, whether or not the call succeeded. */
+zvec_status_t zvec_collection_insert_consume(
+    zvec_collection_t* collection,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec_write_results_t* out_results);
+
+zvec_status_t zvec_collection_upsert_consume(
+    zvec_collection_t* collection,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec_write_results_t* out_results);
+
+zvec_status_t zvec_collection_update_consume(
+    zvec_collection_t* collection,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec_write_results_t* out_results);
+
+/* Columnar writes: build `count` documents directly from a PK array, an
+ * optional row-major count x dimension fp32 matrix for `vector_field`, and
+ * optional scalar columns, without going through zvec_doc_t handles. The
+ * engine's docs own their values, so each vector row is still copied once
+ * into its doc, as are pks and string values; what is saved is the handle
+ * and setter call per row and field. */
+zvec_status_t zvec_collection_insert_columnar(
+    zvec_collection_t* collection,
+    const char** pks,
+    size_t count,
+    const char* vector_field,
+    const float* vectors,
+    size_t dimension,
+    const zvec_column_t* columns,
+    size_t column_count,
+    zvec_write_results_t* out_results);
+
+zvec_status_t zvec_collection_upsert_columnar(
+    zvec_collection_t* collection,
+    const char** pks,
+    size_t count,
+    const char* vector_field,
+    const float* vectors,
+    size_t dimension,
+    const zvec_column_t* columns,
+    size_t column_count,
+    zvec_write_results_t* out_results);
+
 zvec_status_t zvec_collection_update(
     zvec_collection_t* collection,
     zvec_doc_t** docs,
@@ -479,10 +750,88 @@ zvec_status_t zvec_collection_delete(
     size_t count,
     zvec_write_results_t* out_results);
 
+/* Summary-reporting writes. `op` is one of INSERT/UPSERT/UPDATE. */
+zvec_status_t zvec_collection_write_summary(
+    zvec_collection_t* collection,
+    zvec_operator_t op,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec_write_summary_t* out_summary);
+
+zvec_status_t zvec_collection_delete_summary(
+    zvec_collection_t* collection,
+    const char** pks,
+    size_t count,
+    zvec_write_summary_t* out_summary);
+
 zvec_status_t zvec_collection_delete_by_filter(
     zvec_collection_t* collection,
     const char* filter);
 
+/* ============================================================================
+ * Collection - Async Writes
+ * ============================================================================ */
+
+/* Invoked on the wrapper's write thread when an async write completes. The
+ * callback owns `status` and `results` and releases them with
+ * zvec_status_free / zvec_write_results_free. */
+typedef void (*zvec_write_callback_t)(
+    uint64_t ticket,
+    zvec_status_t status,
+    zvec_write_results_t results,
+    void* user_data);
+
+/* Queue a write and return immediately. The docs are copied before returning.
+ * Writes run one at a time in submission order; `out_ticket` receives the id
+ * passed back to the callback. If queueing fails the callback is not invoked. */
+zvec_status_t zvec_collection_insert_async(
+    zvec_collection_t* collection,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec_write_callback_t callback,
+    void* user_data,
+    uint64_t* out_ticket);
+
+zvec_status_t zvec_collection_upsert_async(
+    zvec_collection_t* collection,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec_write_callback_t callback,
+    void* user_data,
+    uint64_t* out_ticket);
+
+/* ============================================================================
+ * Bulk Writer
+ * ============================================================================ */
+
+/* Streams documents into a collection. Added docs are buffered until
+ * `batch_size` accumulate; the full batch is then written on a background
+ * thread while the next one fills. `op` is one of INSERT/UPSERT/UPDATE. */
+zvec_status_t zvec_bulk_writer_open(
+    zvec_collection_t* collection,
+    zvec_operator_t op,
+    size_t batch_size,
+    zvec_bulk_writer_t** out_writer);
+
+/* Copies `docs` into the writer. Blocks only while the previous batch is
+ * still being written and the current one is full. A null doc rejects the
+ * whole call with INVALID_ARGUMENT before any doc is added. */
+zvec_status_t zvec_bulk_writer_add(
+    zvec_bulk_writer_t* writer,
+    zvec_doc_t** docs,
+    size_t count);
+
+/* Writes the remaining buffered docs, waits for the background thread and
+ * flushes the collection. `out_summary` covers every doc added, in order.
+ * Docs in a batch the collection rejected as a whole report that status. */
+zvec_status_t zvec_bulk_writer_finish(
+    zvec_bulk_writer_t* writer,
+    zvec_write_summary_t* out_summary);
+
+/* Frees the writer. Without a prior finish, batches already handed to the
+ * background thread are completed and any partially filled batch is dropped. */
+void zvec_bulk_writer_free(zvec_bulk_writer_t* writer);
+
 /* ============================================================================
  * Collection - DQL Operations
  * ============================================================================ */
@@ -492,6 +841,96 @@ zvec_status_t zvec_collection_query(
     zvec_vector_query_t* query,
     zvec_doc_list_t* out_results);
 
+/* Like zvec_collection_query, but reports through `out_truncated` whether
+ * the query's timeout or cancel token cut it off. Such queries run on a
+ * fixed pool of workers, sized by zvec_set_thread_pool_size at the first
+ * one. The engine search cannot be interrupted, so a cut-off query returns
+ * no hits while its search keeps a worker and CPU until it finishes; the
+ * budget bounds the wait, not the work. Once four searches per worker are
+ * queued or running, new ones are refused and report truncated unrun. */
+zvec_status_t zvec_collection_query_bounded(
+    const zvec_collection_t* collection,
+    zvec_vector_query_t* query,
+    zvec_doc_list_t* out_results,
+    bool* out_truncated);
+
+/* Checks `query` against the collection schema once: the vector field must
+ * exist and output fields, if set, must name existing fields. On success the
+ * query vector buffer of a dense field is sized to the field dimension,
+ * stored in `out_dimension` if given, so later
+ * zvec_vector_query_update_vector_fp32 calls copy in place. Sparse fields
+ * report dimension 0 and keep using the sparse vector setter. */
+zvec_status_t zvec_collection_prepare_query(
+    const zvec_collection_t* collection,
+    zvec_vector_query_t* query,
+    size_t* out_dimension);
+
+/* Opens a cursor over the hits of `query`, ranked as by zvec_collection_query,
+ * that yields them in batches. The query is copied, so it may be freed; the
+ * collection must outlive the iterator. The engine cannot resume a search,
+ * so whenever the buffered hits run out the iterator searches again for a
+ * window four times larger, re-ranking every hit already yielded. Deep
+ * paging therefore costs more than one search for the same number of hits.
+ * Iterator searches do not use the result cache. */
+zvec_search_iterator_t* zvec_collection_search_iterator_new(
+    const zvec_collection_t* collection,
+    const zvec_vector_query_t* query,
+    zvec_status_t* out_status);
+
+/* Writes the next (up to) `batch_size` hits, none repeating an earlier batch;
+ * an empty list means the iterator is exhausted. If the query's timeout or
+ * cancel token cuts a search off, the batch reports stats.truncated and the
+ * iterator is exhausted: later batches only drain hits already buffered. */
+zvec_status_t zvec_search_iterator_next(
+    zvec_search_iterator_t* iterator,
+    size_t batch_size,
+    zvec_doc_list_t* out_results);
+
+void zvec_search_iterator_free(zvec_search_iterator_t* iterator);
+
+/* Runs `query` and writes the hits into `out_results` as flat arrays instead
+ * of one doc handle per hit. `fields`/`field_types` name the scalar fields to
+ * extract; they should also be among the query's output fields. */
+zvec_status_t zvec_collection_query_flat(
+    const zvec_collection_t* collection,
+    zvec_vector_query_t* query,
+    const char** fields,
+    const zvec_data_type_t* field_types,
+    size_t field_count,
+    zvec_flat_results_t* out_results);
+
+/* Runs one query per row of the row-major `query_count` x `dimension` fp32
+ * matrix `vectors`, using `query` as the template for everything but the
+ * vector; each row runs as zvec_collection_query would, with range, rerank
+ * and the result cache. `dimension` must be that of the dense vector field,
+ * and templates set by pk are rejected. Rows run concurrently on the calling
+ * thread and the shared query pool (see zvec_set_thread_pool_size); results
+ * are written to the caller-provided `out_results[query_count]` in row order
+ * and each list must be freed with zvec_doc_list_free. If any query fails,
+ * its status is returned and no lists are filled. Once the template's
+ * timeout is spent or its cancel token fires, no further rows are started:
+ * their lists stay empty and `out_truncated`, if given, is set. */
+zvec_status_t zvec_collection_query_batch(
+    const zvec_collection_t* collection,
+    const zvec_vector_query_t* query,
+    const float* vectors,
+    size_t query_count,
+    size_t dimension,
+    zvec_doc_list_t* out_results,
+    bool* out_truncated);
+
+/* Runs the sub-queries (e.g. a dense and a sparse query) concurrently and
+ * fuses their hits by doc id, returning the top `fusion->topn` docs ordered
+ * by fused score; each doc's score is replaced by its fused score. A
+ * sub-query cut off by its timeout contributes no hits and marks the
+ * result stats truncated. */
+zvec_status_t zvec_collection_hybrid_query(
+    const zvec_collection_t* collection,
+    zvec_vector_query_t** queries,
+    size_t query_count,
+    const zvec_fusion_params_t* fusion,
+    zvec_doc_list_t* out_results);
+
 zvec_status_t zvec_collection_group_by_query(
     const zvec_collection_t* collection,
     zvec_group_by_vector_query_t* query,
@@ -503,6 +942,20 @@ zvec_status_t zvec_collection_fetch(
     size_t count,
     zvec_doc_map_t* out_results);
 
+/* Columnar fetch: writes the fp32 vector `field` of each requested doc into
+ * row i of the caller's row-major count x dimension matrix `out_vectors`, in
+ * input order. Bit i of `out_found` ((count + 7) / 8 bytes, LSB first) is set
+ * when row i was filled; rows of missing docs and vectors of another
+ * dimension are zeroed. Allocates nothing the caller has to free. */
+zvec_status_t zvec_collection_fetch_vectors(
+    const zvec_collection_t* collection,
+    const char** pks,
+    size_t count,
+    const char* field,
+    float* out_vectors,
+    size_t dimension,
+    uint8_t* out_found);
+
 /* ============================================================================
  * Collection - Utility
  * ============================================================================ */
@@ -515,6 +968,9 @@ zvec_status_t zvec_collection_destroy_storage(zvec_collection_t* collection);
  * ============================================================================ */
 
 void zvec_set_log_level(int level);
+/* Threads in the query pool shared by batch queries and bounded queries; 0
+ * (the default) uses one per core. The pool is sized at its first use, so
+ * set this before running such queries. */
 void zvec_set_thread_pool_size(size_t size);
 
 #ifdef __cplusplus
@@ -9,9 +9,18 @@
 #include <zvec/db/index_params.h>
 #include <zvec/db/query_params.h>
 #include <zvec/db/options.h>
+#include <atomic>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 #include <cstdlib>
+#include <cstring>
 
 namespace zvec_wrapper {
 
@@ -29,6 +38,161 @@ inline zvec_status_t to_c_status(const zvec::Status& status) {
     return s;
 }
 
+// Accumulates per-document write statuses, possibly over several batches, and
+// renders them as a zvec_write_summary_t. Only failures are retained.
+class WriteSummaryBuilder {
+public:
+    void add(const zvec::WriteResults& results) {
+        for (size_t i = 0; i < results.size(); i++) {
+            if (static_cast<int>(results[i].code()) != ZVEC_STATUS_OK) {
+                failures_.emplace_back(count_ + i, results[i]);
+            }
+        }
+        count_ += results.size();
+    }
+
+    // Record `count` documents that all failed with `status`.
+    void add_failed(size_t count, const zvec::Status& status) {
+        for (size_t i = 0; i < count; i++) {
+            failures_.emplace_back(count_ + i, status);
+        }
+        count_ += count;
+    }
+
+    void fill(zvec_write_summary_t* out) const {
+        memset(out, 0, sizeof(*out));
+        out->count = count_;
+        out->success_count = count_ - failures_.size();
+        if (failures_.empty()) {
+            return;
+        }
+
+        out->failed_bitmap = (uint8_t*)calloc((count_ + 7) / 8, 1);
+        out->failure_count = failures_.size();
+        out->failed_indices = (size_t*)malloc(sizeof(size_t) * failures_.size());
+        out->failed_codes = (uint8_t*)malloc(failures_.size());
+        for (size_t n = 0; n < failures_.size(); n++) {
+            const size_t i = failures_[n].first;
+            const zvec::Status& status = failures_[n].second;
+            int code = static_cast<int>(status.code());
+            if (code <= ZVEC_STATUS_OK || code > ZVEC_STATUS_UNKNOWN) {
+                code = ZVEC_STATUS_UNKNOWN;
+            }
+            out->failed_bitmap[i / 8] |= (uint8_t)(1u << (i % 8));
+            out->failed_indices[n] = i;
+            out->failed_codes[n] = (uint8_t)code;
+            if (!out->messages[code] && !status.message().empty()) {
+                out->messages[code] = strdup(status.message().c_str());
+            }
+        }
+    }
+
+private:
+    size_t count_ = 0;
+    std::vector<std::pair<size_t, zvec::Status>> failures_;
+};
+
+// fp32 -> reduced-precision conversions (quantize.cpp). Vectorized where the
+// CPU supports it, with the same output on every path. int8/int4 compute
+// round(x / scale), ties to even, clamped to the type's range, and store NaN
+// as the minimum; int4 packs two values per byte, low nibble first. fp16
+// keeps a NaN's sign and top payload bits.
+void fp32_to_fp16(const float* src, uint16_t* dst, size_t n);
+void fp32_to_int8(const float* src, int8_t* dst, size_t n, float scale);
+void fp32_to_int4(const float* src, int8_t* dst, size_t n, float scale);
+
+// fp32 distance kernels (distance.cpp), vectorized with AVX2/FMA or NEON
+// where available.
+float dot_fp32(const float* a, const float* b, size_t n);
+float squared_l2_fp32(const float* a, const float* b, size_t n);
+
+// Engine group-by results behind a zvec_group_results_t. Its docs are handed
+// out through aliasing pointers that share ownership of the whole result.
+using GroupResultsPtr = std::shared_ptr<zvec::GroupResults>;
+
+// Per-handle LRU cache of query results, keyed by cache_key() of the query
+// (collection.cpp). Every write through the handle bumps the epoch; an entry
+// stored under an older epoch is a miss. Results are stored with the epoch
+// read before the search started, so a write that lands mid-search
+// invalidates them too. Invalidation is per handle: writes through another
+// handle or process on the same collection are not seen, and results from
+// before them are served until this handle writes or the entry is evicted.
+//
+// Docs are shared with the results handed out, not copied; a doc handle
+// copies its doc before the first change (doc.cpp), so cached docs are
+// never modified.
+class ResultCache {
+public:
+    explicit ResultCache(size_t capacity) : capacity_(capacity) {}
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    uint64_t epoch() const {
+        return epoch_.load();
+    }
+
+    void invalidate() {
+        epoch_.fetch_add(1);
+    }
+
+    bool get(const std::string& key, zvec::DocPtrList* docs) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return false;
+        }
+        if (it->second->epoch != epoch()) {
+            order_.erase(it->second);
+            index_.erase(it);
+            return false;
+        }
+        order_.splice(order_.begin(), order_, it->second);
+        *docs = it->second->docs;
+        return true;
+    }
+
+    void put(const std::string& key, uint64_t epoch, const zvec::DocPtrList& docs) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (epoch != this->epoch()) {
+            return;
+        }
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            order_.erase(it->second);
+            index_.erase(it);
+        }
+        order_.push_front(Entry{key, epoch, docs});
+        index_[key] = order_.begin();
+        while (order_.size() > capacity_) {
+            index_.erase(order_.back().key);
+            order_.pop_back();
+        }
+    }
+
+private:
+    struct Entry {
+        std::string key;
+        uint64_t epoch;
+        zvec::DocPtrList docs;
+    };
+
+    const size_t capacity_;
+    std::atomic<uint64_t> epoch_{0};
+    std::mutex mutex_;
+    std::list<Entry> order_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+};
+
+// A vector field copied out of its doc by zvec_doc_get_vector_view, cached
+// for later calls; `storage` owns the std::vector that `view.data` points
+// into.
+struct VectorView {
+    std::shared_ptr<const void> storage;
+    zvec_vector_view_t view;
+};
+
 inline zvec::DataType to_cpp_data_type(zvec_data_type_t t) {
     return static_cast<zvec::DataType>(static_cast<uint32_t>(t));
 }
@@ -43,6 +207,8 @@ extern "C" {
 
 struct zvec_collection {
     zvec::Collection::Ptr ptr;
+    // Null unless opened with a result cache capacity.
+    std::shared_ptr<zvec_wrapper::ResultCache> result_cache;
 };
 
 struct zvec_collection_schema {
@@ -59,10 +225,68 @@ struct zvec_doc {
     zvec::Doc::Ptr ptr;
     bool owned;
     mutable std::string string_cache;
+    // One cached copy per vector field read through
+    // zvec_doc_get_vector_view; cleared whenever the doc changes or is reset.
+    mutable std::unordered_map<std::string, zvec_wrapper::VectorView> vector_views;
+};
+
+struct zvec_doc_arena {
+    std::vector<zvec_doc*> docs;
+    size_t next = 0;
 };
 
 struct zvec_vector_query {
     zvec::VectorQuery query;
+    // Output settings from before set_ids_only(true), restored by
+    // set_ids_only(false).
+    struct OutputSettings {
+        std::optional<std::vector<std::string>> output_fields;
+        bool include_vector;
+        bool include_doc_id;
+    };
+    std::optional<OutputSettings> before_ids_only;
+    size_t prepared_dimension = 0;
+    // zvec_query_params::key of the params set on the query, if any.
+    std::string query_params_key;
+    uint64_t timeout_ms = 0;
+    std::shared_ptr<std::atomic<bool>> cancelled;
+    // Search by a stored doc's vector: set by set_by_pk and resolved against
+    // the collection when the query runs.
+    bool by_source = false;
+    std::string source_pk;
+    bool exclude_source = false;
+    // Range mode (set_range): every hit within `radius`, up to max_results.
+    bool ranged = false;
+    float radius = 0.0f;
+    size_t max_results = 0;
+    // Two-stage search (set_rerank): topk * rerank_factor candidates from the
+    // index, re-scored exactly against their stored fp32 vectors.
+    uint32_t rerank_factor = 0;
+    // Metric of the field's index, which range and rerank modes score with;
+    // read from the schema when such a query runs.
+    zvec_metric_type_t metric = ZVEC_METRIC_TYPE_UNDEFINED;
+    // Set on a search iterator's copy, whose one-off windows would only
+    // evict other entries from the result cache.
+    bool uncached = false;
+};
+
+struct zvec_cancel_token {
+    std::shared_ptr<std::atomic<bool>> cancelled = std::make_shared<std::atomic<bool>>(false);
+};
+
+// The engine keeps no traversal state between queries, so the iterator
+// re-runs the whole query over a window of the top hits that grows 4x per
+// refill and buffers the not yet yielded part. Each refill searches again
+// for every hit already yielded; the growth only reduces how often that
+// happens. Its searches bypass the result cache.
+struct zvec_search_iterator {
+    const zvec_collection_t* collection = nullptr;
+    zvec_vector_query_t query;
+    size_t window = 0;
+    bool exhausted = false;
+    zvec::DocPtrList pending;
+    size_t pending_pos = 0;
+    std::unordered_set<std::string> yielded;
 };
 
 struct zvec_group_by_vector_query {
@@ -75,10 +299,14 @@ struct zvec_index_params {
 
 struct zvec_query_params {
     zvec::QueryParams::Ptr ptr;
+    // Index type and setting the params were built from, for the result
+    // cache key.
+    std::string key;
 };
 
 struct zvec_collection_options {
     zvec::CollectionOptions opts;
+    size_t result_cache_capacity = 0;
 };
 
 struct zvec_create_index_options {
@@ -0,0 +1,137 @@
+#include "zvec_c_internal.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+// A single background thread running queued writes in FIFO order. The engine
+// serializes writes internally, so more threads would only reorder them.
+class WriteExecutor {
+public:
+    static WriteExecutor& instance() {
+        // Leaked on purpose: the detached worker may still be running during
+        // static destruction.
+        static WriteExecutor* executor = new WriteExecutor();
+        return *executor;
+    }
+
+    uint64_t post(std::function<void(uint64_t)> task) {
+        const uint64_t ticket = next_ticket_.fetch_add(1) + 1;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.emplace_back(ticket, std::move(task));
+        }
+        cv_.notify_one();
+        return ticket;
+    }
+
+private:
+    WriteExecutor() {
+        std::thread([this] { run(); }).detach();
+    }
+
+    void run() {
+        while (true) {
+            std::pair<uint64_t, std::function<void(uint64_t)>> item;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return !queue_.empty(); });
+                item = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            item.second(item.first);
+        }
+    }
+
+    std::atomic<uint64_t> next_ticket_{0};
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::pair<uint64_t, std::function<void(uint64_t)>>> queue_;
+};
+
+zvec_status_t submit_write(
+    zvec_collection_t* collection,
+    zvec_operator_t op,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec_write_callback_t callback,
+    void* user_data,
+    uint64_t* out_ticket) {
+    
+    if (!collection || !collection->ptr || !docs || count == 0 || !callback) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    auto cpp_docs = std::make_shared<std::vector<zvec::Doc>>();
+    cpp_docs->reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        if (docs[i] && docs[i]->ptr) {
+            cpp_docs->push_back(*docs[i]->ptr);
+        }
+    }
+    
+    zvec::Collection::Ptr target = collection->ptr;
+    std::shared_ptr<zvec_wrapper::ResultCache> cache = collection->result_cache;
+    uint64_t ticket = WriteExecutor::instance().post(
+        [target, cache, op, cpp_docs, callback, user_data](uint64_t id) {
+            auto result = op == ZVEC_OPERATOR_INSERT ? target->Insert(*cpp_docs)
+                                                     : target->Upsert(*cpp_docs);
+            if (cache) {
+                cache->invalidate();
+            }
+            zvec_write_results_t results;
+            results.statuses = nullptr;
+            results.count = 0;
+            if (result.has_value()) {
+                const auto& write_results = result.value();
+                results.count = write_results.size();
+                results.statuses = (zvec_status_t*)malloc(sizeof(zvec_status_t) * write_results.size());
+                for (size_t i = 0; i < write_results.size(); i++) {
+                    results.statuses[i] = zvec_wrapper::to_c_status(write_results[i]);
+                }
+            }
+            callback(id,
+                     result.has_value() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(result.error()),
+                     results,
+                     user_data);
+        });
+    
+    if (out_ticket) {
+        *out_ticket = ticket;
+    }
+    return zvec_wrapper::ok_status();
+}
+
+}
+
+extern "C" {
+
+zvec_status_t zvec_collection_insert_async(
+    zvec_collection_t* collection,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec_write_callback_t callback,
+    void* user_data,
+    uint64_t* out_ticket) {
+    return submit_write(collection, ZVEC_OPERATOR_INSERT, docs, count, callback, user_data, out_ticket);
+}
+
+zvec_status_t zvec_collection_upsert_async(
+    zvec_collection_t* collection,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec_write_callback_t callback,
+    void* user_data,
+    uint64_t* out_ticket) {
+    return submit_write(collection, ZVEC_OPERATOR_UPSERT, docs, count, callback, user_data, out_ticket);
+}
+
+}
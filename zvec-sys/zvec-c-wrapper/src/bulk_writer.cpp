@@ -0,0 +1,195 @@
+#include "zvec_c_internal.h"
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+extern "C" {
+
+// Two doc buffers are cycled between the producer and the background thread:
+// the producer fills `filling` while the worker writes `pending`. Buffers are
+// cleared rather than reallocated, so after the first two batches the doc
+// vectors keep their capacity.
+struct zvec_bulk_writer {
+    zvec::Collection::Ptr collection;
+    std::shared_ptr<zvec_wrapper::ResultCache> result_cache;
+    zvec_operator_t op;
+    size_t batch_size;
+
+    std::vector<zvec::Doc> filling;
+    std::vector<zvec::Doc> pending;
+    bool has_pending = false;
+    bool stopping = false;
+    bool finished = false;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::thread worker;
+
+    // Only touched by the worker until it has been joined.
+    zvec_wrapper::WriteSummaryBuilder summary;
+};
+
+}
+
+namespace {
+
+void write_batch(zvec_bulk_writer* writer, std::vector<zvec::Doc>& docs) {
+    auto& collection = writer->collection;
+    auto result = writer->op == ZVEC_OPERATOR_INSERT ? collection->Insert(docs)
+                : writer->op == ZVEC_OPERATOR_UPSERT ? collection->Upsert(docs)
+                : collection->Update(docs);
+    if (writer->result_cache) {
+        writer->result_cache->invalidate();
+    }
+    if (result.has_value()) {
+        writer->summary.add(result.value());
+    } else {
+        writer->summary.add_failed(docs.size(), result.error());
+    }
+}
+
+void run_worker(zvec_bulk_writer* writer) {
+    std::unique_lock<std::mutex> lock(writer->mutex);
+    while (true) {
+        writer->cv.wait(lock, [writer] { return writer->has_pending || writer->stopping; });
+        if (!writer->has_pending) {
+            return;
+        }
+        lock.unlock();
+        write_batch(writer, writer->pending);
+        writer->pending.clear();
+        lock.lock();
+        writer->has_pending = false;
+        writer->cv.notify_all();
+    }
+}
+
+// Hands the filling buffer to the worker, waiting for the previous batch first.
+void submit(zvec_bulk_writer* writer) {
+    std::unique_lock<std::mutex> lock(writer->mutex);
+    writer->cv.wait(lock, [writer] { return !writer->has_pending; });
+    std::swap(writer->filling, writer->pending);
+    writer->has_pending = true;
+    writer->cv.notify_all();
+}
+
+void stop(zvec_bulk_writer* writer) {
+    {
+        std::lock_guard<std::mutex> lock(writer->mutex);
+        writer->stopping = true;
+    }
+    writer->cv.notify_all();
+    if (writer->worker.joinable()) {
+        writer->worker.join();
+    }
+}
+
+}
+
+extern "C" {
+
+zvec_status_t zvec_bulk_writer_open(
+    zvec_collection_t* collection,
+    zvec_operator_t op,
+    size_t batch_size,
+    zvec_bulk_writer_t** out_writer) {
+    
+    if (!collection || !collection->ptr || batch_size == 0 || !out_writer ||
+        (op != ZVEC_OPERATOR_INSERT && op != ZVEC_OPERATOR_UPSERT && op != ZVEC_OPERATOR_UPDATE)) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    auto* writer = new zvec_bulk_writer();
+    writer->collection = collection->ptr;
+    writer->result_cache = collection->result_cache;
+    writer->op = op;
+    writer->batch_size = batch_size;
+    writer->filling.reserve(batch_size);
+    writer->pending.reserve(batch_size);
+    writer->worker = std::thread(run_worker, writer);
+    
+    *out_writer = writer;
+    return zvec_wrapper::ok_status();
+}
+
+zvec_status_t zvec_bulk_writer_add(
+    zvec_bulk_writer_t* writer,
+    zvec_doc_t** docs,
+    size_t count) {
+    
+    if (!writer || (!docs && count > 0)) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    // Summary entries follow the order of the docs added, so a skipped doc
+    // would shift every later one.
+    for (size_t i = 0; i < count; i++) {
+        if (!docs[i] || !docs[i]->ptr) {
+            zvec_status_t s;
+            s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+            s.message = strdup(("Null doc at index " + std::to_string(i)).c_str());
+            return s;
+        }
+    }
+    if (writer->finished) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_FAILED_PRECONDITION;
+        s.message = strdup("Bulk writer already finished");
+        return s;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        writer->filling.push_back(*docs[i]->ptr);
+        if (writer->filling.size() >= writer->batch_size) {
+            submit(writer);
+        }
+    }
+    
+    return zvec_wrapper::ok_status();
+}
+
+zvec_status_t zvec_bulk_writer_finish(
+    zvec_bulk_writer_t* writer,
+    zvec_write_summary_t* out_summary) {
+    
+    if (!writer) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    if (writer->finished) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_FAILED_PRECONDITION;
+        s.message = strdup("Bulk writer already finished");
+        return s;
+    }
+    
+    if (!writer->filling.empty()) {
+        submit(writer);
+    }
+    stop(writer);
+    writer->finished = true;
+    
+    if (out_summary) {
+        writer->summary.fill(out_summary);
+    }
+    
+    auto status = writer->collection->Flush();
+    return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
+}
+
+void zvec_bulk_writer_free(zvec_bulk_writer_t* writer) {
+    if (writer) {
+        writer->filling.clear();
+        stop(writer);
+        delete writer;
+    }
+}
+
+}
@@ -1,5 +1,774 @@
 #include "zvec_c_internal.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <thread>
+
+namespace {
+
+std::atomic<size_t> g_thread_count{0};
+
+size_t thread_count() {
+    const size_t threads = g_thread_count.load();
+    return threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+}
+
+zvec::Result<zvec::WriteResults> run_write(
+    zvec::Collection& collection,
+    zvec_operator_t op,
+    std::vector<zvec::Doc>& docs) {
+    if (op == ZVEC_OPERATOR_INSERT) {
+        return collection.Insert(docs);
+    }
+    if (op == ZVEC_OPERATOR_UPSERT) {
+        return collection.Upsert(docs);
+    }
+    return collection.Update(docs);
+}
+
+// Copies and writes `docs`. The engine serializes writes internally, so the
+// batch goes to it in one call.
+zvec::Status write_docs(
+    zvec::Collection& collection,
+    zvec_operator_t op,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec::WriteResults& out) {
+    
+    std::vector<zvec::Doc> cpp_docs;
+    cpp_docs.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        if (docs[i] && docs[i]->ptr) {
+            cpp_docs.push_back(*docs[i]->ptr);
+        }
+    }
+    auto result = run_write(collection, op, cpp_docs);
+    if (!result.has_value()) {
+        return result.error();
+    }
+    out = std::move(result.value());
+    return zvec::Status::OK();
+}
+
+uint64_t elapsed_ns(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+void fill_doc_list(const zvec::DocPtrList& docs, zvec_doc_list_t* out) {
+    out->stats = zvec_query_stats_t{};
+    out->count = docs.size();
+    out->docs = (zvec_doc_t**)malloc(sizeof(zvec_doc_t*) * docs.size());
+    for (size_t i = 0; i < docs.size(); i++) {
+        auto* doc = new zvec_doc_t;
+        doc->ptr = docs[i];
+        doc->owned = false;
+        out->docs[i] = doc;
+    }
+}
+
+// The timeout and cancel token of one query execution.
+class QueryBudget {
+public:
+    explicit QueryBudget(const zvec_vector_query_t* query)
+        : timed_(query->timeout_ms > 0),
+          deadline_(std::chrono::steady_clock::now() + std::chrono::milliseconds(query->timeout_ms)),
+          cancelled_(query->cancelled) {}
+
+    bool bounded() const {
+        return timed_ || cancelled_;
+    }
+
+    bool expired() const {
+        return (cancelled_ && cancelled_->load()) ||
+               (timed_ && std::chrono::steady_clock::now() >= deadline_);
+    }
+
+    // Next time to re-check expiry: the deadline, or sooner to notice a cancel.
+    std::chrono::steady_clock::time_point next_check() const {
+        if (!cancelled_) {
+            return deadline_;
+        }
+        auto poll = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+        return timed_ ? std::min(poll, deadline_) : poll;
+    }
+
+private:
+    bool timed_;
+    std::chrono::steady_clock::time_point deadline_;
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+struct PendingQuery {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::optional<zvec::Result<zvec::DocPtrList>> result;
+};
+
+// Fixed set of worker threads shared by bounded queries and by batch and
+// hybrid queries (run_all). The engine search cannot be interrupted: a
+// caller whose budget expires stops waiting, but a search already started
+// keeps its worker, and the CPU, until it finishes. Queued searches whose
+// budget expired are skipped. At most kMaxInFlightPerWorker searches per
+// worker may be queued or running; further submissions are refused. A
+// search whose caller timed out still holds its slot until it finishes, so a
+// run of slow searches can fill the pool and refuse new ones even though
+// every caller has given up.
+class BoundedQueryPool {
+public:
+    // True on the pool's worker threads.
+    static bool on_worker() {
+        return on_worker_;
+    }
+    
+    static BoundedQueryPool& instance() {
+        // Never destroyed: at exit a worker may still be inside a search.
+        static BoundedQueryPool* pool = new BoundedQueryPool(thread_count());
+        return *pool;
+    }
+
+    bool submit(std::function<void()> task) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (in_flight_ >= capacity_) {
+            return false;
+        }
+        in_flight_++;
+        tasks_.push_back(std::move(task));
+        cv_.notify_one();
+        return true;
+    }
+    
+    // Runs task(0) .. task(count - 1) on the pool and the calling thread and
+    // returns once all have finished. The caller takes tasks too, so tasks
+    // the pool refuses, or has not started by then, run on the caller.
+    // `task` must not throw.
+    void run_all(size_t count, const std::function<void(size_t)>& task) {
+        struct Shared {
+            std::function<void(size_t)> task;
+            size_t count;
+            std::atomic<size_t> next{0};
+            std::mutex mutex;
+            std::condition_variable cv;
+            size_t done = 0;
+        };
+        auto shared = std::make_shared<Shared>();
+        shared->task = task;
+        shared->count = count;
+        // A helper that starts after the caller claimed every task runs
+        // nothing, so `task` and what it refers to need not outlive this call.
+        auto drain = [shared] {
+            size_t i;
+            while ((i = shared->next.fetch_add(1)) < shared->count) {
+                shared->task(i);
+                std::lock_guard<std::mutex> lock(shared->mutex);
+                if (++shared->done == shared->count) {
+                    shared->cv.notify_all();
+                }
+            }
+        };
+        for (size_t t = 1; t < std::min(count, workers_); t++) {
+            if (!submit(drain)) {
+                break;
+            }
+        }
+        drain();
+        std::unique_lock<std::mutex> lock(shared->mutex);
+        shared->cv.wait(lock, [&] { return shared->done == shared->count; });
+    }
+
+private:
+    static constexpr size_t kMaxInFlightPerWorker = 4;
+
+    explicit BoundedQueryPool(size_t workers) : workers_(workers), capacity_(workers * kMaxInFlightPerWorker) {
+        for (size_t i = 0; i < workers; i++) {
+            std::thread([this] { work(); }).detach();
+        }
+    }
+
+    void work() {
+        on_worker_ = true;
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            cv_.wait(lock, [this] { return !tasks_.empty(); });
+            auto task = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            try {
+                task();
+            } catch (...) {
+                // The slot is released either way. A search that threw
+                // leaves no result, so its caller gives up when its budget
+                // expires.
+            }
+            lock.lock();
+            in_flight_--;
+        }
+    }
+
+    static thread_local bool on_worker_;
+    
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    size_t in_flight_ = 0;
+    const size_t workers_;
+    const size_t capacity_;
+};
+
+thread_local bool BoundedQueryPool::on_worker_ = false;
+
+// Runs the query on the bounded query pool and waits until it completes or
+// the budget expires. An abandoned search that already started runs to
+// completion and its result is dropped. When the pool is saturated the query
+// is not started and, like an expired one, yields nullopt.
+std::optional<zvec::Result<zvec::DocPtrList>> run_bounded_query(
+    const zvec::Collection::Ptr& collection,
+    const zvec::VectorQuery& query,
+    const QueryBudget& budget) {
+    
+    auto pending = std::make_shared<PendingQuery>();
+    const bool submitted = BoundedQueryPool::instance().submit([collection, query, budget, pending] {
+        if (budget.expired()) {
+            return;
+        }
+        auto result = collection->Query(query);
+        std::lock_guard<std::mutex> lock(pending->mutex);
+        pending->result.emplace(std::move(result));
+        pending->cv.notify_all();
+    });
+    if (!submitted) {
+        return std::nullopt;
+    }
+    
+    std::unique_lock<std::mutex> lock(pending->mutex);
+    while (!pending->result.has_value()) {
+        if (budget.expired()) {
+            return std::nullopt;
+        }
+        pending->cv.wait_until(lock, budget.next_check());
+    }
+    return std::move(pending->result);
+}
+
+std::optional<zvec::Result<zvec::DocPtrList>> run_once(
+    const zvec_collection_t* collection,
+    const zvec::VectorQuery& query,
+    const QueryBudget& budget) {
+    if (!budget.bounded()) {
+        return collection->ptr->Query(query);
+    }
+    if (budget.expired()) {
+        return std::nullopt;
+    }
+    // A pool worker (a hybrid sub-query) searches itself: waiting on another
+    // worker could leave every worker waiting on searches queued behind it.
+    if (BoundedQueryPool::on_worker()) {
+        return collection->ptr->Query(query);
+    }
+    return run_bounded_query(collection->ptr, query, budget);
+}
+
+bool within_radius(const zvec_vector_query_t* query, float score) {
+    return query->metric == ZVEC_METRIC_TYPE_IP ? score >= query->radius : score <= query->radius;
+}
+
+// Range mode: one ordinary search for max_results hits, keeping those inside
+// the radius; the engine takes no radius. The cap is required, so the search
+// size is always bounded.
+std::optional<zvec::Result<zvec::DocPtrList>> run_range_query(
+    const zvec_collection_t* collection,
+    const zvec_vector_query_t* query,
+    const QueryBudget& budget) {
+    
+    zvec::VectorQuery probe = query->query;
+    probe.topk_ = static_cast<int>(std::min<size_t>(query->max_results, std::numeric_limits<int>::max()));
+    auto result = run_once(collection, probe, budget);
+    if (result && result->has_value()) {
+        auto& docs = result->value();
+        docs.erase(std::find_if_not(docs.begin(), docs.end(),
+                                    [query](const zvec::Doc::Ptr& doc) { return within_radius(query, doc->score()); }),
+                   docs.end());
+    }
+    return result;
+}
+
+float exact_score(zvec_metric_type_t metric, const float* query, float query_norm,
+                  const std::vector<float>& vector) {
+    switch (metric) {
+        case ZVEC_METRIC_TYPE_IP:
+            return zvec_wrapper::dot_fp32(query, vector.data(), vector.size());
+        case ZVEC_METRIC_TYPE_COSINE: {
+            const float norm = std::sqrt(zvec_wrapper::dot_fp32(vector.data(), vector.data(), vector.size()));
+            const float dot = zvec_wrapper::dot_fp32(query, vector.data(), vector.size());
+            return query_norm > 0.0f && norm > 0.0f ? 1.0f - dot / (query_norm * norm) : 1.0f;
+        }
+        default:
+            return zvec_wrapper::squared_l2_fp32(query, vector.data(), vector.size());
+    }
+}
+
+// Re-scores `candidates` against their stored fp32 vectors under the field's
+// metric and keeps the best `keep`. Vectors come from the candidates when the
+// query includes them, else from one Fetch, whose failure fails the query.
+// Candidates without a stored vector keep their index order and score, after
+// the rest.
+zvec::Status rerank_candidates(
+    const zvec_collection_t* collection,
+    const zvec_vector_query_t* query,
+    size_t keep,
+    zvec::DocPtrList& candidates) {
+    
+    std::vector<std::string> pks;
+    if (!query->query.include_vector_) {
+        pks.reserve(candidates.size());
+        for (const auto& doc : candidates) {
+            pks.push_back(doc->pk());
+        }
+    }
+    auto fetched = pks.empty() ? zvec::Result<zvec::DocPtrMap>(zvec::DocPtrMap())
+                               : collection->ptr->Fetch(pks);
+    if (!fetched.has_value()) {
+        return fetched.error();
+    }
+    
+    const float* vector = reinterpret_cast<const float*>(query->query.query_vector_.data());
+    const size_t dimension = query->query.query_vector_.size() / sizeof(float);
+    const float query_norm = std::sqrt(zvec_wrapper::dot_fp32(vector, vector, dimension));
+    const bool higher_is_closer = query->metric == ZVEC_METRIC_TYPE_IP;
+    struct Scored {
+        zvec::Doc::Ptr doc;
+        float score;
+        bool exact;
+    };
+    std::vector<Scored> scored;
+    scored.reserve(candidates.size());
+    for (auto& doc : candidates) {
+        const zvec::Doc* source = doc.get();
+        if (!pks.empty()) {
+            auto it = fetched.value().find(doc->pk());
+            source = it != fetched.value().end() ? it->second.get() : nullptr;
+        }
+        auto stored = source ? source->get<std::vector<float>>(query->query.field_name_) : std::nullopt;
+        if (stored && stored->size() == dimension) {
+            scored.push_back({std::move(doc), exact_score(query->metric, vector, query_norm, *stored), true});
+        } else {
+            scored.push_back({std::move(doc), 0.0f, false});
+        }
+    }
+    std::stable_sort(scored.begin(), scored.end(), [higher_is_closer](const Scored& a, const Scored& b) {
+        if (a.exact != b.exact) {
+            return a.exact;
+        }
+        return a.exact && (higher_is_closer ? a.score > b.score : a.score < b.score);
+    });
+    
+    // Copies, so setting the exact score leaves the engine's docs untouched.
+    candidates.clear();
+    for (size_t i = 0; i < scored.size() && i < keep; i++) {
+        if (!scored[i].exact) {
+            candidates.push_back(std::move(scored[i].doc));
+            continue;
+        }
+        auto doc = std::make_shared<zvec::Doc>(*scored[i].doc);
+        doc->set_score(scored[i].score);
+        candidates.push_back(std::move(doc));
+    }
+    return zvec::Status::OK();
+}
+
+// Two-stage mode: over-fetches topk * rerank_factor candidates from the
+// (possibly quantized) index for rerank_candidates to cut down to topk.
+std::optional<zvec::Result<zvec::DocPtrList>> run_candidate_query(
+    const zvec_collection_t* collection,
+    const zvec_vector_query_t* query,
+    const QueryBudget& budget) {
+    
+    const size_t topk = std::max(query->query.topk_, 1);
+    zvec::VectorQuery probe = query->query;
+    probe.topk_ = static_cast<int>(std::min<size_t>(topk * query->rerank_factor, std::numeric_limits<int>::max()));
+    return run_once(collection, probe, budget);
+}
+
+// Called after every change made through the handle: cached results from
+// before it may no longer be valid.
+void invalidate_results(const zvec_collection_t* collection) {
+    if (collection->result_cache) {
+        collection->result_cache->invalidate();
+    }
+}
+
+template <typename T>
+void append_raw(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void append_part(std::string& key, const std::string& part) {
+    append_raw(key, part.size());
+    key += part;
+}
+
+// Everything that determines a query's results, with variable-length parts
+// length-prefixed so adjacent parts cannot run together. Query params are
+// keyed by what the wrapper built them from, which is all it can set.
+std::string cache_key(const zvec_vector_query_t* query) {
+    const auto& q = query->query;
+    std::string key;
+    key.reserve(q.query_vector_.size() + q.query_sparse_indices_.size() +
+                q.query_sparse_values_.size() + q.filter_.size() + 128);
+    append_part(key, q.field_name_);
+    append_part(key, q.query_vector_);
+    append_part(key, q.query_sparse_indices_);
+    append_part(key, q.query_sparse_values_);
+    append_part(key, q.filter_);
+    append_part(key, query->query_params_key);
+    append_raw(key, q.topk_);
+    append_raw(key, q.include_vector_);
+    append_raw(key, q.include_doc_id_);
+    append_raw(key, q.output_fields_.has_value());
+    if (q.output_fields_) {
+        append_raw(key, q.output_fields_->size());
+        for (const auto& field : *q.output_fields_) {
+            append_part(key, field);
+        }
+    }
+    append_raw(key, query->ranged);
+    if (query->ranged) {
+        append_raw(key, query->radius);
+        append_raw(key, query->max_results);
+    }
+    append_raw(key, query->rerank_factor);
+    append_raw(key, query->metric);
+    append_raw(key, query->exclude_source);
+    if (query->exclude_source) {
+        append_part(key, query->source_pk);
+    }
+    return key;
+}
+
+// The metric a vector field is indexed with; IP, the engine's default, for a
+// field without a vector index.
+zvec_metric_type_t index_metric(const zvec::FieldSchema& field) {
+    auto params = std::dynamic_pointer_cast<zvec::VectorIndexParams>(field.index_params());
+    if (!params) {
+        return ZVEC_METRIC_TYPE_IP;
+    }
+    return static_cast<zvec_metric_type_t>(static_cast<uint32_t>(params->metric_type()));
+}
+
+bool is_sparse(const zvec::FieldSchema& field) {
+    const auto data_type = zvec_wrapper::to_c_data_type(field.data_type());
+    return data_type == ZVEC_DATA_TYPE_SPARSE_VECTOR_FP16 || data_type == ZVEC_DATA_TYPE_SPARSE_VECTOR_FP32;
+}
+
+// Runs `query` within its budget into `out`, which is left empty if the
+// budget cut it off. Complete results are served from and stored in the
+// result cache, if any, unless the query is marked uncached.
+zvec::Status run_query(
+    const zvec_collection_t* collection,
+    const zvec_vector_query_t* query,
+    std::optional<zvec::DocPtrList>* out) {
+    out->reset();
+    std::shared_ptr<zvec_wrapper::ResultCache> cache;
+    if (!query->uncached) {
+        cache = collection->result_cache;
+    }
+    std::string key;
+    if (cache) {
+        key = cache_key(query);
+    }
+    uint64_t epoch = 0;
+    if (cache) {
+        epoch = cache->epoch();
+        zvec::DocPtrList docs;
+        if (cache->get(key, &docs)) {
+            out->emplace(std::move(docs));
+            return zvec::Status::OK();
+        }
+    }
+    
+    const QueryBudget budget(query);
+    const bool rerank = query->rerank_factor > 1 && !query->query.query_vector_.empty();
+    std::optional<zvec::Result<zvec::DocPtrList>> result;
+    if (query->ranged) {
+        result = run_range_query(collection, query, budget);
+    } else if (rerank) {
+        result = run_candidate_query(collection, query, budget);
+    } else {
+        result = run_once(collection, query->query, budget);
+    }
+    if (!result) {
+        return zvec::Status::OK();
+    }
+    if (!result->has_value()) {
+        return result->error();
+    }
+    auto& docs = result->value();
+    if (rerank) {
+        // Range hits are reranked as found; exact scores that leave the
+        // radius drop the hit.
+        const size_t keep = query->ranged ? docs.size() : std::max(query->query.topk_, 1);
+        const zvec::Status status = rerank_candidates(collection, query, keep, docs);
+        if (!status.ok()) {
+            return status;
+        }
+        if (query->ranged) {
+            docs.erase(std::remove_if(docs.begin(), docs.end(),
+                                      [query](const zvec::Doc::Ptr& doc) { return !within_radius(query, doc->score()); }),
+                       docs.end());
+        }
+    }
+    // A resolved source query asked for one extra hit to make room for the
+    // source doc; drop it, or the surplus hit if the source was filtered out.
+    if (query->exclude_source && !query->by_source && !query->source_pk.empty()) {
+        docs.erase(std::remove_if(docs.begin(), docs.end(),
+                                  [&](const zvec::Doc::Ptr& doc) { return doc->pk() == query->source_pk; }),
+                   docs.end());
+        const size_t limit = query->ranged ? query->max_results : static_cast<size_t>(query->query.topk_);
+        if (docs.size() >= limit) {
+            docs.resize(limit - 1);
+        }
+    }
+    if (cache) {
+        cache->put(key, epoch, docs);
+    }
+    out->emplace(std::move(docs));
+    return zvec::Status::OK();
+}
+
+// For range and rerank modes, points `query` at a copy in `storage` with the
+// metric of the field's index; a query set by pk or doc id is also pointed at
+// one that searches with the source doc's stored vector. Other queries are
+// left as is.
+zvec::Status resolve_source(
+    const zvec_collection_t* collection,
+    const zvec_vector_query_t** query,
+    std::optional<zvec_vector_query_t>* storage) {
+    
+    if (((*query)->ranged || (*query)->rerank_factor > 1) && (*query)->metric == ZVEC_METRIC_TYPE_UNDEFINED) {
+        auto schema = collection->ptr->Schema();
+        if (!schema.has_value()) {
+            return schema.error();
+        }
+        zvec_vector_query_t& resolved = storage->emplace(**query);
+        for (const auto& field : schema.value().vector_fields()) {
+            if (field->name() == resolved.query.field_name_) {
+                resolved.metric = index_metric(*field);
+            }
+        }
+        *query = &resolved;
+    }
+    if (!(*query)->by_source) {
+        return zvec::Status::OK();
+    }
+    std::string pk = (*query)->source_pk;
+    auto fetched = collection->ptr->Fetch({pk});
+    if (!fetched.has_value()) {
+        return fetched.error();
+    }
+    auto it = fetched.value().find(pk);
+    if (it == fetched.value().end() || !it->second) {
+        return zvec::Status::NotFound("Source doc not found: " + pk);
+    }
+    
+    zvec_vector_query_t& resolved = storage->has_value() ? **storage : storage->emplace(**query);
+    const std::string& field = resolved.query.field_name_;
+    if (auto dense = it->second->get<std::vector<float>>(field)) {
+        resolved.query.query_vector_.assign(reinterpret_cast<const char*>(dense->data()),
+                                            dense->size() * sizeof(float));
+    } else if (auto sparse = it->second->get<std::pair<std::vector<uint32_t>, std::vector<float>>>(field)) {
+        resolved.query.query_sparse_indices_.assign(reinterpret_cast<const char*>(sparse->first.data()),
+                                                    sparse->first.size() * sizeof(uint32_t));
+        resolved.query.query_sparse_values_.assign(reinterpret_cast<const char*>(sparse->second.data()),
+                                                   sparse->second.size() * sizeof(float));
+    } else {
+        return zvec::Status::InvalidArgument("Source doc has no fp32 vector in field " + field);
+    }
+    resolved.by_source = false;
+    resolved.source_pk = std::move(pk);
+    if (resolved.exclude_source) {
+        resolved.query.topk_ += 1;
+        resolved.max_results += 1;
+    }
+    *query = &resolved;
+    return zvec::Status::OK();
+}
+
+// Maps a sub-query score to [0, 1], higher meaning more similar, so scores
+// of different sub-queries can be weighted and summed.
+double normalize_score(zvec_metric_type_t metric, float score) {
+    const double pi = 3.14159265358979323846;
+    switch (metric) {
+        case ZVEC_METRIC_TYPE_L2: return 1.0 - 2.0 * std::atan(score) / pi;
+        case ZVEC_METRIC_TYPE_IP: return 0.5 + std::atan(score) / pi;
+        case ZVEC_METRIC_TYPE_COSINE: return 1.0 - score / 2.0;
+        default: return score;
+    }
+}
+
+template<typename T>
+void fill_flat_column(const zvec::DocPtrList& docs, zvec_flat_column_t& column) {
+    T* values = static_cast<T*>(calloc(docs.size() + 1, sizeof(T)));
+    const std::string name(column.name);
+    for (size_t i = 0; i < docs.size(); i++) {
+        auto value = docs[i]->get<T>(name);
+        if (value.has_value()) {
+            values[i] = value.value();
+            column.valid[i] = true;
+        }
+    }
+    column.data = values;
+}
+
+template<typename T>
+void set_column(std::vector<zvec::Doc>& docs, const std::string& name, const void* data) {
+    const T* values = static_cast<const T*>(data);
+    for (size_t i = 0; i < docs.size(); i++) {
+        docs[i].set(name, values[i]);
+    }
+}
+
+zvec_status_t build_columnar_docs(
+    const char** pks,
+    size_t count,
+    const char* vector_field,
+    const float* vectors,
+    size_t dimension,
+    const zvec_column_t* columns,
+    size_t column_count,
+    std::vector<zvec::Doc>& docs) {
+    
+    if ((vector_field == nullptr) != (vectors == nullptr) || (vectors && dimension == 0) ||
+        (column_count > 0 && !columns)) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid columnar arguments");
+        return s;
+    }
+    
+    docs.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        if (!pks[i]) {
+            zvec_status_t s;
+            s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+            s.message = strdup("Null primary key");
+            return s;
+        }
+        docs[i].set_pk(std::string(pks[i]));
+    }
+    
+    if (vector_field) {
+        // zvec::Doc owns its values, so each row is copied into its doc.
+        const std::string field(vector_field);
+        for (size_t i = 0; i < count; i++) {
+            const float* row = vectors + i * dimension;
+            docs[i].set(field, std::vector<float>(row, row + dimension));
+        }
+    }
+    
+    for (size_t c = 0; c < column_count; c++) {
+        const auto& column = columns[c];
+        if (!column.name || !column.data) {
+            zvec_status_t s;
+            s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+            s.message = strdup("Invalid column");
+            return s;
+        }
+        const std::string name(column.name);
+        switch (column.data_type) {
+            case ZVEC_DATA_TYPE_BOOL: set_column<bool>(docs, name, column.data); break;
+            case ZVEC_DATA_TYPE_INT32: set_column<int32_t>(docs, name, column.data); break;
+            case ZVEC_DATA_TYPE_INT64: set_column<int64_t>(docs, name, column.data); break;
+            case ZVEC_DATA_TYPE_UINT32: set_column<uint32_t>(docs, name, column.data); break;
+            case ZVEC_DATA_TYPE_UINT64: set_column<uint64_t>(docs, name, column.data); break;
+            case ZVEC_DATA_TYPE_FLOAT: set_column<float>(docs, name, column.data); break;
+            case ZVEC_DATA_TYPE_DOUBLE: set_column<double>(docs, name, column.data); break;
+            case ZVEC_DATA_TYPE_STRING: {
+                const char* const* values = static_cast<const char* const*>(column.data);
+                for (size_t i = 0; i < count; i++) {
+                    if (values[i]) {
+                        docs[i].set<std::string>(name, std::string(values[i]));
+                    } else {
+                        docs[i].set_null(name);
+                    }
+                }
+                break;
+            }
+            default: {
+                zvec_status_t s;
+                s.code = ZVEC_STATUS_NOT_SUPPORTED;
+                s.message = strdup("Unsupported column data type");
+                return s;
+            }
+        }
+    }
+    
+    return zvec_wrapper::ok_status();
+}
+
+// Fetches `pks` and copies the vector `field` of each into row rows[i] of
+// `out_vectors`. Rows not filled stay zeroed with their bit clear.
+zvec::Status fetch_vector_rows(
+    const zvec_collection_t* collection,
+    const std::vector<std::string>& pks,
+    const std::vector<size_t>& rows,
+    size_t count,
+    const std::string& field,
+    float* out_vectors,
+    size_t dimension,
+    uint8_t* out_found) {
+    
+    std::memset(out_vectors, 0, count * dimension * sizeof(float));
+    std::memset(out_found, 0, (count + 7) / 8);
+    if (pks.empty()) {
+        return zvec::Status::OK();
+    }
+    auto result = collection->ptr->Fetch(pks);
+    if (!result.has_value()) {
+        return result.error();
+    }
+    const auto& doc_map = result.value();
+    for (size_t i = 0; i < pks.size(); i++) {
+        auto it = doc_map.find(pks[i]);
+        if (it == doc_map.end() || !it->second) {
+            continue;
+        }
+        auto vector = it->second->get<std::vector<float>>(field);
+        if (!vector || vector->size() != dimension) {
+            continue;
+        }
+        const size_t row = rows[i];
+        std::memcpy(out_vectors + row * dimension, vector->data(), dimension * sizeof(float));
+        out_found[row / 8] |= static_cast<uint8_t>(1u << (row % 8));
+    }
+    return zvec::Status::OK();
+}
+
+std::vector<zvec::Doc> take_docs(zvec_doc_t** docs, size_t count) {
+    std::vector<zvec::Doc> cpp_docs;
+    cpp_docs.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        if (docs[i] && docs[i]->ptr) {
+            // Docs still shared with a result list or another handle are copied.
+            if (docs[i]->owned && docs[i]->ptr.use_count() == 1) {
+                cpp_docs.push_back(std::move(*docs[i]->ptr));
+            } else {
+                cpp_docs.push_back(*docs[i]->ptr);
+            }
+        }
+        zvec_doc_free(docs[i]);
+        docs[i] = nullptr;
+    }
+    return cpp_docs;
+}
+
+}
 
 extern "C" {
 
@@ -26,6 +795,10 @@ zvec_collection_t* zvec_collection_create_and_open(
     if (result.has_value()) {
         auto* collection = new zvec_collection_t;
         collection->ptr = result.value();
+        if (options && options->result_cache_capacity > 0) {
+            collection->result_cache =
+                std::make_shared<zvec_wrapper::ResultCache>(options->result_cache_capacity);
+        }
         if (out_status) {
             *out_status = zvec_wrapper::ok_status();
         }
@@ -60,6 +833,10 @@ zvec_collection_t* zvec_collection_open(
     if (result.has_value()) {
         auto* collection = new zvec_collection_t;
         collection->ptr = result.value();
+        if (options && options->result_cache_capacity > 0) {
+            collection->result_cache =
+                std::make_shared<zvec_wrapper::ResultCache>(options->result_cache_capacity);
+        }
         if (out_status) {
             *out_status = zvec_wrapper::ok_status();
         }
@@ -125,6 +902,7 @@ zvec_status_t zvec_collection_options(const zvec_collection_t* collection,
     if (result.has_value()) {
         auto* opts = new zvec_collection_options_t;
         opts->opts = result.value();
+        opts->result_cache_capacity = collection->result_cache ? collection->result_cache->capacity() : 0;
         *out_options = opts;
         return zvec_wrapper::ok_status();
     }
@@ -181,6 +959,7 @@ zvec_status_t zvec_collection_create_index(
     }
     
     auto status = collection->ptr->CreateIndex(std::string(column_name), index_params->ptr, opts);
+    invalidate_results(collection);
     return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
 }
 
@@ -196,6 +975,7 @@ zvec_status_t zvec_collection_drop_index(
     }
     
     auto status = collection->ptr->DropIndex(std::string(column_name));
+    invalidate_results(collection);
     return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
 }
 
@@ -216,6 +996,7 @@ zvec_status_t zvec_collection_optimize(
     }
     
     auto status = collection->ptr->Optimize(opts);
+    invalidate_results(collection);
     return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
 }
 
@@ -237,6 +1018,7 @@ zvec_status_t zvec_collection_add_column(
         std::string(expression),
         opts
     );
+    invalidate_results(collection);
     return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
 }
 
@@ -252,6 +1034,7 @@ zvec_status_t zvec_collection_drop_column(
     }
     
     auto status = collection->ptr->DropColumn(std::string(column_name));
+    invalidate_results(collection);
     return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
 }
 
@@ -278,6 +1061,7 @@ zvec_status_t zvec_collection_alter_column(
         std::string(column_name), 
         rename ? std::string(rename) : std::string(),
         new_schema, opts);
+    invalidate_results(collection);
     return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
 }
 
@@ -294,17 +1078,10 @@ zvec_status_t zvec_collection_insert(
         return s;
     }
     
-    std::vector<zvec::Doc> cpp_docs;
-    cpp_docs.reserve(count);
-    for (size_t i = 0; i < count; i++) {
-        if (docs[i] && docs[i]->ptr) {
-            cpp_docs.push_back(*docs[i]->ptr);
-        }
-    }
-    
-    auto result = collection->ptr->Insert(cpp_docs);
-    if (result.has_value() && out_results) {
-        const auto& write_results = result.value();
+    zvec::WriteResults write_results;
+    auto status = write_docs(*collection->ptr, ZVEC_OPERATOR_INSERT, docs, count, write_results);
+    invalidate_results(collection);
+    if (status.ok() && out_results) {
         out_results->count = write_results.size();
         out_results->statuses = (zvec_status_t*)malloc(sizeof(zvec_status_t) * write_results.size());
         for (size_t i = 0; i < write_results.size(); i++) {
@@ -312,7 +1089,7 @@ zvec_status_t zvec_collection_insert(
         }
     }
     
-    return result.has_value() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(result.error());
+    return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
 }
 
 zvec_status_t zvec_collection_upsert(
@@ -328,17 +1105,10 @@ zvec_status_t zvec_collection_upsert(
         return s;
     }
     
-    std::vector<zvec::Doc> cpp_docs;
-    cpp_docs.reserve(count);
-    for (size_t i = 0; i < count; i++) {
-        if (docs[i] && docs[i]->ptr) {
-            cpp_docs.push_back(*docs[i]->ptr);
-        }
-    }
-    
-    auto result = collection->ptr->Upsert(cpp_docs);
-    if (result.has_value() && out_results) {
-        const auto& write_results = result.value();
+    zvec::WriteResults write_results;
+    auto status = write_docs(*collection->ptr, ZVEC_OPERATOR_UPSERT, docs, count, write_results);
+    invalidate_results(collection);
+    if (status.ok() && out_results) {
         out_results->count = write_results.size();
         out_results->statuses = (zvec_status_t*)malloc(sizeof(zvec_status_t) * write_results.size());
         for (size_t i = 0; i < write_results.size(); i++) {
@@ -346,7 +1116,7 @@ zvec_status_t zvec_collection_upsert(
         }
     }
     
-    return result.has_value() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(result.error());
+    return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
 }
 
 zvec_status_t zvec_collection_update(
@@ -362,17 +1132,10 @@ zvec_status_t zvec_collection_update(
         return s;
     }
     
-    std::vector<zvec::Doc> cpp_docs;
-    cpp_docs.reserve(count);
-    for (size_t i = 0; i < count; i++) {
-        if (docs[i] && docs[i]->ptr) {
-            cpp_docs.push_back(*docs[i]->ptr);
-        }
-    }
-    
-    auto result = collection->ptr->Update(cpp_docs);
-    if (result.has_value() && out_results) {
-        const auto& write_results = result.value();
+    zvec::WriteResults write_results;
+    auto status = write_docs(*collection->ptr, ZVEC_OPERATOR_UPDATE, docs, count, write_results);
+    invalidate_results(collection);
+    if (status.ok() && out_results) {
         out_results->count = write_results.size();
         out_results->statuses = (zvec_status_t*)malloc(sizeof(zvec_status_t) * write_results.size());
         for (size_t i = 0; i < write_results.size(); i++) {
@@ -380,29 +1143,213 @@ zvec_status_t zvec_collection_update(
         }
     }
     
-    return result.has_value() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(result.error());
+    return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
 }
 
-zvec_status_t zvec_collection_delete(
+zvec_status_t zvec_collection_insert_consume(
     zvec_collection_t* collection,
-    const char** pks,
+    zvec_doc_t** docs,
     size_t count,
     zvec_write_results_t* out_results) {
     
-    if (!collection || !collection->ptr || !pks || count == 0) {
+    if (!docs || count == 0) {
         zvec_status_t s;
         s.code = ZVEC_STATUS_INVALID_ARGUMENT;
         s.message = strdup("Invalid arguments");
         return s;
     }
     
-    std::vector<std::string> cpp_pks;
-    cpp_pks.reserve(count);
-    for (size_t i = 0; i < count; i++) {
-        cpp_pks.emplace_back(pks[i]);
-    }
+    auto cpp_docs = take_docs(docs, count);
+    if (!collection || !collection->ptr) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid collection");
+        return s;
+    }
+    
+    auto result = collection->ptr->Insert(cpp_docs);
+    invalidate_results(collection);
+    if (result.has_value() && out_results) {
+        const auto& write_results = result.value();
+        out_results->count = write_results.size();
+        out_results->statuses = (zvec_status_t*)malloc(sizeof(zvec_status_t) * write_results.size());
+        for (size_t i = 0; i < write_results.size(); i++) {
+            out_results->statuses[i] = zvec_wrapper::to_c_status(write_results[i]);
+        }
+    }
+    
+    return result.has_value() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(result.error());
+}
+
+zvec_status_t zvec_collection_upsert_consume(
+    zvec_collection_t* collection,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec_write_results_t* out_results) {
+    
+    if (!docs || count == 0) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    auto cpp_docs = take_docs(docs, count);
+    if (!collection || !collection->ptr) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid collection");
+        return s;
+    }
+    
+    auto result = collection->ptr->Upsert(cpp_docs);
+    invalidate_results(collection);
+    if (result.has_value() && out_results) {
+        const auto& write_results = result.value();
+        out_results->count = write_results.size();
+        out_results->statuses = (zvec_status_t*)malloc(sizeof(zvec_status_t) * write_results.size());
+        for (size_t i = 0; i < write_results.size(); i++) {
+            out_results->statuses[i] = zvec_wrapper::to_c_status(write_results[i]);
+        }
+    }
+    
+    return result.has_value() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(result.error());
+}
+
+zvec_status_t zvec_collection_update_consume(
+    zvec_collection_t* collection,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec_write_results_t* out_results) {
+    
+    if (!docs || count == 0) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    auto cpp_docs = take_docs(docs, count);
+    if (!collection || !collection->ptr) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid collection");
+        return s;
+    }
+    
+    auto result = collection->ptr->Update(cpp_docs);
+    invalidate_results(collection);
+    if (result.has_value() && out_results) {
+        const auto& write_results = result.value();
+        out_results->count = write_results.size();
+        out_results->statuses = (zvec_status_t*)malloc(sizeof(zvec_status_t) * write_results.size());
+        for (size_t i = 0; i < write_results.size(); i++) {
+            out_results->statuses[i] = zvec_wrapper::to_c_status(write_results[i]);
+        }
+    }
+    
+    return result.has_value() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(result.error());
+}
+
+zvec_status_t zvec_collection_insert_columnar(
+    zvec_collection_t* collection,
+    const char** pks,
+    size_t count,
+    const char* vector_field,
+    const float* vectors,
+    size_t dimension,
+    const zvec_column_t* columns,
+    size_t column_count,
+    zvec_write_results_t* out_results) {
+    
+    if (!collection || !collection->ptr || !pks || count == 0) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    std::vector<zvec::Doc> cpp_docs;
+    auto build_status = build_columnar_docs(
+        pks, count, vector_field, vectors, dimension, columns, column_count, cpp_docs);
+    if (build_status.code != ZVEC_STATUS_OK) {
+        return build_status;
+    }
+    
+    auto result = collection->ptr->Insert(cpp_docs);
+    invalidate_results(collection);
+    if (result.has_value() && out_results) {
+        const auto& write_results = result.value();
+        out_results->count = write_results.size();
+        out_results->statuses = (zvec_status_t*)malloc(sizeof(zvec_status_t) * write_results.size());
+        for (size_t i = 0; i < write_results.size(); i++) {
+            out_results->statuses[i] = zvec_wrapper::to_c_status(write_results[i]);
+        }
+    }
+    
+    return result.has_value() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(result.error());
+}
+
+zvec_status_t zvec_collection_upsert_columnar(
+    zvec_collection_t* collection,
+    const char** pks,
+    size_t count,
+    const char* vector_field,
+    const float* vectors,
+    size_t dimension,
+    const zvec_column_t* columns,
+    size_t column_count,
+    zvec_write_results_t* out_results) {
+    
+    if (!collection || !collection->ptr || !pks || count == 0) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    std::vector<zvec::Doc> cpp_docs;
+    auto build_status = build_columnar_docs(
+        pks, count, vector_field, vectors, dimension, columns, column_count, cpp_docs);
+    if (build_status.code != ZVEC_STATUS_OK) {
+        return build_status;
+    }
+    
+    auto result = collection->ptr->Upsert(cpp_docs);
+    invalidate_results(collection);
+    if (result.has_value() && out_results) {
+        const auto& write_results = result.value();
+        out_results->count = write_results.size();
+        out_results->statuses = (zvec_status_t*)malloc(sizeof(zvec_status_t) * write_results.size());
+        for (size_t i = 0; i < write_results.size(); i++) {
+            out_results->statuses[i] = zvec_wrapper::to_c_status(write_results[i]);
+        }
+    }
+    
+    return result.has_value() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(result.error());
+}
+
+zvec_status_t zvec_collection_delete(
+    zvec_collection_t* collection,
+    const char** pks,
+    size_t count,
+    zvec_write_results_t* out_results) {
+    
+    if (!collection || !collection->ptr || !pks || count == 0) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    std::vector<std::string> cpp_pks;
+    cpp_pks.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        cpp_pks.emplace_back(pks[i]);
+    }
     
     auto result = collection->ptr->Delete(cpp_pks);
+    invalidate_results(collection);
     if (result.has_value() && out_results) {
         const auto& write_results = result.value();
         out_results->count = write_results.size();
@@ -415,6 +1362,68 @@ zvec_status_t zvec_collection_delete(
     return result.has_value() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(result.error());
 }
 
+zvec_status_t zvec_collection_write_summary(
+    zvec_collection_t* collection,
+    zvec_operator_t op,
+    zvec_doc_t** docs,
+    size_t count,
+    zvec_write_summary_t* out_summary) {
+    
+    if (!collection || !collection->ptr || !docs || count == 0) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    if (op != ZVEC_OPERATOR_INSERT && op != ZVEC_OPERATOR_UPSERT && op != ZVEC_OPERATOR_UPDATE) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Unsupported write operator");
+        return s;
+    }
+    
+    zvec::WriteResults write_results;
+    auto status = write_docs(*collection->ptr, op, docs, count, write_results);
+    invalidate_results(collection);
+    if (status.ok() && out_summary) {
+        zvec_wrapper::WriteSummaryBuilder summary;
+        summary.add(write_results);
+        summary.fill(out_summary);
+    }
+    
+    return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
+}
+
+zvec_status_t zvec_collection_delete_summary(
+    zvec_collection_t* collection,
+    const char** pks,
+    size_t count,
+    zvec_write_summary_t* out_summary) {
+    
+    if (!collection || !collection->ptr || !pks || count == 0) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    std::vector<std::string> cpp_pks;
+    cpp_pks.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        cpp_pks.emplace_back(pks[i]);
+    }
+    
+    auto result = collection->ptr->Delete(cpp_pks);
+    invalidate_results(collection);
+    if (result.has_value() && out_summary) {
+        zvec_wrapper::WriteSummaryBuilder summary;
+        summary.add(result.value());
+        summary.fill(out_summary);
+    }
+    
+    return result.has_value() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(result.error());
+}
+
 zvec_status_t zvec_collection_delete_by_filter(
     zvec_collection_t* collection,
     const char* filter) {
@@ -427,6 +1436,7 @@ zvec_status_t zvec_collection_delete_by_filter(
     }
     
     auto status = collection->ptr->DeleteByFilter(std::string(filter));
+    invalidate_results(collection);
     return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
 }
 
@@ -434,6 +1444,14 @@ zvec_status_t zvec_collection_query(
     const zvec_collection_t* collection,
     zvec_vector_query_t* query,
     zvec_doc_list_t* out_results) {
+    return zvec_collection_query_bounded(collection, query, out_results, nullptr);
+}
+
+zvec_status_t zvec_collection_query_bounded(
+    const zvec_collection_t* collection,
+    zvec_vector_query_t* query,
+    zvec_doc_list_t* out_results,
+    bool* out_truncated) {
     
     if (!collection || !collection->ptr || !query || !out_results) {
         zvec_status_t s;
@@ -442,20 +1460,488 @@ zvec_status_t zvec_collection_query(
         return s;
     }
     
-    auto result = collection->ptr->Query(query->query);
-    if (result.has_value()) {
-        const auto& docs = result.value();
-        out_results->count = docs.size();
-        out_results->docs = (zvec_doc_t**)malloc(sizeof(zvec_doc_t*) * docs.size());
-        for (size_t i = 0; i < docs.size(); i++) {
-            auto* doc = new zvec_doc_t;
-            doc->ptr = docs[i];
-            doc->owned = false;
-            out_results->docs[i] = doc;
+    if (out_truncated) {
+        *out_truncated = false;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const zvec_vector_query_t* effective = query;
+    std::optional<zvec_vector_query_t> resolved;
+    const zvec::Status status = resolve_source(collection, &effective, &resolved);
+    if (!status.ok()) {
+        return zvec_wrapper::to_c_status(status);
+    }
+    std::optional<zvec::DocPtrList> result;
+    const zvec::Status query_status = run_query(collection, effective, &result);
+    if (!query_status.ok()) {
+        return zvec_wrapper::to_c_status(query_status);
+    }
+    const uint64_t search_ns = elapsed_ns(start);
+    if (!result.has_value()) {
+        if (out_truncated) {
+            *out_truncated = true;
         }
+        out_results->docs = nullptr;
+        out_results->count = 0;
+        out_results->stats = zvec_query_stats_t{};
+        out_results->stats.search_ns = search_ns;
+        out_results->stats.truncated = true;
         return zvec_wrapper::ok_status();
     }
-    return zvec_wrapper::to_c_status(result.error());
+    const auto materialize_start = std::chrono::steady_clock::now();
+    const auto& docs = *result;
+    fill_doc_list(docs, out_results);
+    out_results->stats.search_ns = search_ns;
+    out_results->stats.materialize_ns = elapsed_ns(materialize_start);
+    out_results->stats.hit_count = docs.size();
+    return zvec_wrapper::ok_status();
+}
+
+zvec_status_t zvec_collection_prepare_query(
+    const zvec_collection_t* collection,
+    zvec_vector_query_t* query,
+    size_t* out_dimension) {
+    
+    if (!collection || !collection->ptr || !query) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    auto schema = collection->ptr->Schema();
+    if (!schema.has_value()) {
+        return zvec_wrapper::to_c_status(schema.error());
+    }
+    zvec::FieldSchema::Ptr vector_field;
+    for (const auto& field : schema.value().vector_fields()) {
+        if (field->name() == query->query.field_name_) {
+            vector_field = field;
+        }
+    }
+    if (!vector_field) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup(("Unknown vector field: " + query->query.field_name_).c_str());
+        return s;
+    }
+    if (query->query.output_fields_.has_value()) {
+        const auto names = schema.value().all_field_names();
+        for (const auto& field : query->query.output_fields_.value()) {
+            if (std::find(names.begin(), names.end(), field) == names.end()) {
+                zvec_status_t s;
+                s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+                s.message = strdup(("Unknown output field: " + field).c_str());
+                return s;
+            }
+        }
+    }
+    
+    // Sparse fields have no fixed dimension: their vector is set with the
+    // sparse setter and update_vector_fp32 stays unavailable.
+    const bool sparse = is_sparse(*vector_field);
+    const size_t dimension = sparse ? 0 : vector_field->dimension();
+    query->prepared_dimension = dimension;
+    if (!sparse) {
+        query->query.query_vector_.resize(dimension * sizeof(float));
+    }
+    if (out_dimension) {
+        *out_dimension = dimension;
+    }
+    return zvec_wrapper::ok_status();
+}
+
+zvec_search_iterator_t* zvec_collection_search_iterator_new(
+    const zvec_collection_t* collection,
+    const zvec_vector_query_t* query,
+    zvec_status_t* out_status) {
+    
+    if (!collection || !collection->ptr || !query) {
+        if (out_status) {
+            out_status->code = ZVEC_STATUS_INVALID_ARGUMENT;
+            out_status->message = strdup("Invalid arguments");
+        }
+        return nullptr;
+    }
+    
+    const zvec_vector_query_t* effective = query;
+    std::optional<zvec_vector_query_t> resolved;
+    const zvec::Status status = resolve_source(collection, &effective, &resolved);
+    if (!status.ok()) {
+        if (out_status) {
+            *out_status = zvec_wrapper::to_c_status(status);
+        }
+        return nullptr;
+    }
+    
+    auto* iterator = new zvec_search_iterator_t;
+    iterator->collection = collection;
+    iterator->query = *effective;
+    iterator->query.uncached = true;
+    // The window replaces topk, so an excluded source is skipped as if it
+    // had already been yielded instead of trimming each window.
+    if (iterator->query.exclude_source && !iterator->query.source_pk.empty()) {
+        iterator->yielded.insert(iterator->query.source_pk);
+        iterator->query.exclude_source = false;
+    }
+    if (out_status) {
+        *out_status = zvec_wrapper::ok_status();
+    }
+    return iterator;
+}
+
+zvec_status_t zvec_search_iterator_next(
+    zvec_search_iterator_t* iterator,
+    size_t batch_size,
+    zvec_doc_list_t* out_results) {
+    
+    if (!iterator || batch_size == 0 || !out_results) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    const auto start = std::chrono::steady_clock::now();
+    bool truncated = false;
+    while (iterator->pending.size() - iterator->pending_pos < batch_size && !iterator->exhausted) {
+        const size_t wanted = iterator->yielded.size() + batch_size;
+        const size_t max_window = std::numeric_limits<int>::max();
+        iterator->window = std::min(std::max(iterator->window * 4, wanted), max_window);
+        iterator->query.query.topk_ = static_cast<int>(iterator->window);
+        std::optional<zvec::DocPtrList> result;
+        const zvec::Status status = run_query(iterator->collection, &iterator->query, &result);
+        if (!status.ok()) {
+            return zvec_wrapper::to_c_status(status);
+        }
+        if (!result.has_value()) {
+            // A cancelled token stays cancelled, and a wider search would
+            // outrun the timeout again; stop rather than retry every call.
+            truncated = true;
+            iterator->exhausted = true;
+            break;
+        }
+        auto& docs = *result;
+        iterator->exhausted = docs.size() < iterator->window || iterator->window == max_window;
+        // A wider search may rank the hits it shares with the last one
+        // differently; only hits not yet yielded are kept, in the new order.
+        iterator->pending.clear();
+        iterator->pending_pos = 0;
+        for (auto& doc : docs) {
+            if (!iterator->yielded.count(doc->pk())) {
+                iterator->pending.push_back(std::move(doc));
+            }
+        }
+    }
+    const uint64_t search_ns = elapsed_ns(start);
+    
+    const auto materialize_start = std::chrono::steady_clock::now();
+    const size_t count = std::min(batch_size, iterator->pending.size() - iterator->pending_pos);
+    const auto first = iterator->pending.begin() + iterator->pending_pos;
+    zvec::DocPtrList batch(first, first + count);
+    iterator->pending_pos += count;
+    for (const auto& doc : batch) {
+        iterator->yielded.insert(doc->pk());
+    }
+    fill_doc_list(batch, out_results);
+    out_results->stats.search_ns = search_ns;
+    out_results->stats.materialize_ns = elapsed_ns(materialize_start);
+    out_results->stats.hit_count = batch.size();
+    out_results->stats.truncated = truncated;
+    return zvec_wrapper::ok_status();
+}
+
+void zvec_search_iterator_free(zvec_search_iterator_t* iterator) {
+    delete iterator;
+}
+
+zvec_status_t zvec_collection_query_flat(
+    const zvec_collection_t* collection,
+    zvec_vector_query_t* query,
+    const char** fields,
+    const zvec_data_type_t* field_types,
+    size_t field_count,
+    zvec_flat_results_t* out_results) {
+    
+    if (!collection || !collection->ptr || !query || !out_results ||
+        (field_count > 0 && (!fields || !field_types))) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    for (size_t f = 0; f < field_count; f++) {
+        if (!fields[f] || field_types[f] < ZVEC_DATA_TYPE_BOOL || field_types[f] > ZVEC_DATA_TYPE_DOUBLE) {
+            zvec_status_t s;
+            s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+            s.message = strdup("Flat results only support numeric and bool fields");
+            return s;
+        }
+    }
+    
+    const zvec_vector_query_t* effective = query;
+    std::optional<zvec_vector_query_t> resolved;
+    const zvec::Status status = resolve_source(collection, &effective, &resolved);
+    if (!status.ok()) {
+        return zvec_wrapper::to_c_status(status);
+    }
+    std::optional<zvec::DocPtrList> result;
+    const zvec::Status query_status = run_query(collection, effective, &result);
+    if (!query_status.ok()) {
+        return zvec_wrapper::to_c_status(query_status);
+    }
+    // A query cut off by its budget yields no hits.
+    if (!result.has_value()) {
+        result.emplace();
+    }
+    const auto& docs = *result;
+    
+    const size_t count = docs.size();
+    size_t pk_bytes = 0;
+    for (const auto& doc : docs) {
+        pk_bytes += doc->pk().size();
+    }
+    // Arrays are sized at least one element so empty results still get
+    // non-null buffers.
+    out_results->count = count;
+    out_results->pk_data = (char*)malloc(pk_bytes + 1);
+    out_results->pk_offsets = (size_t*)malloc(sizeof(size_t) * (count + 1));
+    out_results->scores = (float*)malloc(sizeof(float) * (count + 1));
+    out_results->doc_ids = (uint64_t*)malloc(sizeof(uint64_t) * (count + 1));
+    size_t offset = 0;
+    for (size_t i = 0; i < count; i++) {
+        const std::string& pk = docs[i]->pk();
+        std::memcpy(out_results->pk_data + offset, pk.data(), pk.size());
+        out_results->pk_offsets[i] = offset;
+        offset += pk.size();
+        out_results->scores[i] = docs[i]->score();
+        out_results->doc_ids[i] = docs[i]->doc_id();
+    }
+    out_results->pk_offsets[count] = offset;
+    
+    out_results->column_count = field_count;
+    out_results->columns = (zvec_flat_column_t*)malloc(sizeof(zvec_flat_column_t) * (field_count + 1));
+    for (size_t f = 0; f < field_count; f++) {
+        zvec_flat_column_t& column = out_results->columns[f];
+        column.name = strdup(fields[f]);
+        column.data_type = field_types[f];
+        column.valid = (bool*)calloc(count + 1, sizeof(bool));
+        switch (field_types[f]) {
+            case ZVEC_DATA_TYPE_BOOL: fill_flat_column<bool>(docs, column); break;
+            case ZVEC_DATA_TYPE_INT32: fill_flat_column<int32_t>(docs, column); break;
+            case ZVEC_DATA_TYPE_INT64: fill_flat_column<int64_t>(docs, column); break;
+            case ZVEC_DATA_TYPE_UINT32: fill_flat_column<uint32_t>(docs, column); break;
+            case ZVEC_DATA_TYPE_UINT64: fill_flat_column<uint64_t>(docs, column); break;
+            case ZVEC_DATA_TYPE_FLOAT: fill_flat_column<float>(docs, column); break;
+            default: fill_flat_column<double>(docs, column); break;
+        }
+    }
+    return zvec_wrapper::ok_status();
+}
+
+zvec_status_t zvec_collection_query_batch(
+    const zvec_collection_t* collection,
+    const zvec_vector_query_t* query,
+    const float* vectors,
+    size_t query_count,
+    size_t dimension,
+    zvec_doc_list_t* out_results,
+    bool* out_truncated) {
+    
+    if (!collection || !collection->ptr || !query || !vectors || query_count == 0 ||
+        dimension == 0 || !out_results) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    if (query->by_source) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Batch query template cannot search by a stored doc");
+        return s;
+    }
+    auto schema = collection->ptr->Schema();
+    if (!schema.has_value()) {
+        return zvec_wrapper::to_c_status(schema.error());
+    }
+    zvec::FieldSchema::Ptr vector_field;
+    for (const auto& field : schema.value().vector_fields()) {
+        if (field->name() == query->query.field_name_) {
+            vector_field = field;
+        }
+    }
+    if (!vector_field || is_sparse(*vector_field) || vector_field->dimension() != dimension) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup(("Dimension does not match dense vector field: " + query->query.field_name_).c_str());
+        return s;
+    }
+    
+    std::vector<zvec::DocPtrList> results(query_count);
+    std::vector<zvec::Status> errors(query_count, zvec::Status::OK());
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::atomic<bool> truncated{false};
+    std::vector<uint64_t> search_ns(query_count, 0);
+    const QueryBudget budget(query);
+    // Each worker copies the template once and overwrites the vector bytes in
+    // place for every row it picks up. Rows run like single queries (range,
+    // rerank, result cache); the budget applies to the batch as a whole, so
+    // it is checked before each row rather than inside it.
+    auto worker = [&] {
+        zvec_vector_query_t local = *query;
+        local.metric = index_metric(*vector_field);
+        local.timeout_ms = 0;
+        local.cancelled.reset();
+        local.query.query_vector_.resize(dimension * sizeof(float));
+        size_t i;
+        while (!failed.load() && (i = next.fetch_add(1)) < query_count) {
+            if (budget.expired()) {
+                truncated.store(true);
+                break;
+            }
+            std::memcpy(&local.query.query_vector_[0], vectors + i * dimension, dimension * sizeof(float));
+            const auto start = std::chrono::steady_clock::now();
+            std::optional<zvec::DocPtrList> result;
+            const zvec::Status status = run_query(collection, &local, &result);
+            search_ns[i] = elapsed_ns(start);
+            if (!status.ok()) {
+                errors[i] = status;
+                failed.store(true);
+            } else if (!result) {
+                truncated.store(true);
+            } else {
+                results[i] = std::move(*result);
+            }
+        }
+    };
+    
+    BoundedQueryPool::instance().run_all(std::min(thread_count(), query_count), [&](size_t) { worker(); });
+    
+    for (const auto& error : errors) {
+        if (!error.ok()) {
+            return zvec_wrapper::to_c_status(error);
+        }
+    }
+    for (size_t i = 0; i < query_count; i++) {
+        const auto materialize_start = std::chrono::steady_clock::now();
+        fill_doc_list(results[i], &out_results[i]);
+        out_results[i].stats.search_ns = search_ns[i];
+        out_results[i].stats.materialize_ns = elapsed_ns(materialize_start);
+        out_results[i].stats.hit_count = results[i].size();
+    }
+    if (out_truncated) {
+        *out_truncated = truncated.load();
+    }
+    return zvec_wrapper::ok_status();
+}
+
+zvec_status_t zvec_collection_hybrid_query(
+    const zvec_collection_t* collection,
+    zvec_vector_query_t** queries,
+    size_t query_count,
+    const zvec_fusion_params_t* fusion,
+    zvec_doc_list_t* out_results) {
+    
+    if (!collection || !collection->ptr || !queries || query_count == 0 || !fusion || !out_results ||
+        std::any_of(queries, queries + query_count, [](zvec_vector_query_t* q) { return !q; })) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    // Sub-queries run on copies that always include doc ids, the fusion key.
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<zvec_vector_query_t> locals;
+    locals.reserve(query_count);
+    for (size_t q = 0; q < query_count; q++) {
+        const zvec_vector_query_t* effective = queries[q];
+        std::optional<zvec_vector_query_t> resolved;
+        const zvec::Status status = resolve_source(collection, &effective, &resolved);
+        if (!status.ok()) {
+            return zvec_wrapper::to_c_status(status);
+        }
+        locals.push_back(*effective);
+        locals.back().query.include_doc_id_ = true;
+    }
+    std::vector<std::optional<zvec::DocPtrList>> results(query_count);
+    std::vector<zvec::Status> errors(query_count, zvec::Status::OK());
+    BoundedQueryPool::instance().run_all(
+        query_count, [&](size_t q) { errors[q] = run_query(collection, &locals[q], &results[q]); });
+    for (const auto& error : errors) {
+        if (!error.ok()) {
+            return zvec_wrapper::to_c_status(error);
+        }
+    }
+    const uint64_t search_ns = elapsed_ns(start);
+    
+    // Weighted fusion normalizes each sub-query's scores for its own field.
+    std::vector<zvec_metric_type_t> metrics(query_count, ZVEC_METRIC_TYPE_IP);
+    if (fusion->kind == ZVEC_FUSION_WEIGHTED) {
+        auto schema = collection->ptr->Schema();
+        if (!schema.has_value()) {
+            return zvec_wrapper::to_c_status(schema.error());
+        }
+        for (const auto& field : schema.value().vector_fields()) {
+            for (size_t q = 0; q < query_count; q++) {
+                if (field->name() == locals[q].query.field_name_) {
+                    metrics[q] = index_metric(*field);
+                }
+            }
+        }
+    }
+    
+    const auto materialize_start = std::chrono::steady_clock::now();
+    struct Fused {
+        zvec::Doc::Ptr doc;
+        double score;
+    };
+    std::vector<Fused> fused;
+    std::unordered_map<uint64_t, size_t> positions;
+    bool truncated = false;
+    for (size_t q = 0; q < query_count; q++) {
+        if (!results[q].has_value()) {
+            truncated = true;
+            continue;
+        }
+        auto& docs = *results[q];
+        const double weight = fusion->weights ? fusion->weights[q] : 1.0;
+        for (size_t rank = 0; rank < docs.size(); rank++) {
+            const double contribution = fusion->kind == ZVEC_FUSION_RRF
+                ? 1.0 / (fusion->rank_constant + rank + 1.0)
+                : weight * normalize_score(metrics[q], docs[rank]->score());
+            auto inserted = positions.emplace(docs[rank]->doc_id(), fused.size());
+            if (inserted.second) {
+                fused.push_back({std::move(docs[rank]), 0.0});
+            }
+            fused[inserted.first->second].score += contribution;
+        }
+    }
+    std::stable_sort(fused.begin(), fused.end(),
+                     [](const Fused& a, const Fused& b) { return a.score > b.score; });
+    if (fused.size() > fusion->topn) {
+        fused.resize(fusion->topn);
+    }
+    
+    // The fused docs are taken from the sub-query results; only those also
+    // held by the result cache are copied before their score is replaced.
+    zvec::DocPtrList docs;
+    docs.reserve(fused.size());
+    for (auto& entry : fused) {
+        if (entry.doc.use_count() > 1) {
+            entry.doc = std::make_shared<zvec::Doc>(*entry.doc);
+        }
+        entry.doc->set_score(static_cast<float>(entry.score));
+        docs.push_back(std::move(entry.doc));
+    }
+    fill_doc_list(docs, out_results);
+    out_results->stats.search_ns = search_ns;
+    out_results->stats.materialize_ns = elapsed_ns(materialize_start);
+    out_results->stats.hit_count = docs.size();
+    out_results->stats.truncated = truncated;
+    return zvec_wrapper::ok_status();
 }
 
 zvec_status_t zvec_collection_group_by_query(
@@ -470,23 +1956,34 @@ zvec_status_t zvec_collection_group_by_query(
         return s;
     }
     
+    const auto start = std::chrono::steady_clock::now();
     auto result = collection->ptr->GroupByQuery(query->query);
+    const uint64_t search_ns = elapsed_ns(start);
     if (result.has_value()) {
-        const auto& groups = result.value();
-        out_results->count = groups.size();
-        out_results->groups = (zvec_group_result_t*)malloc(sizeof(zvec_group_result_t) * groups.size());
-        for (size_t i = 0; i < groups.size(); i++) {
-            out_results->groups[i].group_by_value = strdup(groups[i].group_by_value_.c_str());
-            const auto& docs = groups[i].docs_;
-            out_results->groups[i].docs.count = docs.size();
-            out_results->groups[i].docs.docs = (zvec_doc_t**)malloc(sizeof(zvec_doc_t*) * docs.size());
-            for (size_t j = 0; j < docs.size(); j++) {
+        const auto materialize_start = std::chrono::steady_clock::now();
+        auto groups = std::make_shared<zvec::GroupResults>(std::move(result.value()));
+        size_t hit_count = 0;
+        out_results->count = groups->size();
+        out_results->groups = (zvec_group_result_t*)malloc(sizeof(zvec_group_result_t) * groups->size());
+        for (size_t i = 0; i < groups->size(); i++) {
+            auto& group = (*groups)[i];
+            out_results->groups[i].group_by_value = group.group_by_value_.c_str();
+            out_results->groups[i].docs.count = group.docs_.size();
+            out_results->groups[i].docs.stats = zvec_query_stats_t{};
+            out_results->groups[i].docs.docs = (zvec_doc_t**)malloc(sizeof(zvec_doc_t*) * group.docs_.size());
+            hit_count += group.docs_.size();
+            for (size_t j = 0; j < group.docs_.size(); j++) {
                 auto* doc = new zvec_doc_t;
-                doc->ptr = std::make_shared<zvec::Doc>(docs[j]);
-                doc->owned = true;
+                doc->ptr = zvec::Doc::Ptr(groups, &group.docs_[j]);
+                doc->owned = false;
                 out_results->groups[i].docs.docs[j] = doc;
             }
         }
+        out_results->owner = new zvec_wrapper::GroupResultsPtr(std::move(groups));
+        out_results->stats = zvec_query_stats_t{};
+        out_results->stats.search_ns = search_ns;
+        out_results->stats.materialize_ns = elapsed_ns(materialize_start);
+        out_results->stats.hit_count = hit_count;
         return zvec_wrapper::ok_status();
     }
     return zvec_wrapper::to_c_status(result.error());
@@ -531,6 +2028,38 @@ zvec_status_t zvec_collection_fetch(
     return zvec_wrapper::to_c_status(result.error());
 }
 
+zvec_status_t zvec_collection_fetch_vectors(
+    const zvec_collection_t* collection,
+    const char** pks,
+    size_t count,
+    const char* field,
+    float* out_vectors,
+    size_t dimension,
+    uint8_t* out_found) {
+    
+    if (!collection || !collection->ptr || !pks || count == 0 || !field || !out_vectors ||
+        dimension == 0 || !out_found) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    
+    std::vector<std::string> cpp_pks;
+    std::vector<size_t> rows;
+    cpp_pks.reserve(count);
+    rows.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        if (pks[i]) {
+            cpp_pks.emplace_back(pks[i]);
+            rows.push_back(i);
+        }
+    }
+    
+    auto status = fetch_vector_rows(collection, cpp_pks, rows, count, field, out_vectors, dimension, out_found);
+    return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
+}
+
 zvec_status_t zvec_collection_flush(zvec_collection_t* collection) {
     if (!collection || !collection->ptr) {
         zvec_status_t s;
@@ -552,6 +2081,7 @@ zvec_status_t zvec_collection_destroy_storage(zvec_collection_t* collection) {
     }
     
     auto status = collection->ptr->Destroy();
+    invalidate_results(collection);
     return status.ok() ? zvec_wrapper::ok_status() : zvec_wrapper::to_c_status(status);
 }
 
@@ -560,7 +2090,7 @@ void zvec_set_log_level(int level) {
 }
 
 void zvec_set_thread_pool_size(size_t size) {
-    (void)size;
+    g_thread_count.store(size);
 }
 
 }
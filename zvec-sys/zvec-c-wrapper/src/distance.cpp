@@ -0,0 +1,137 @@
+#include "zvec_c_internal.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ZVEC_DISTANCE_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define ZVEC_DISTANCE_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+float dot_scalar(const float* a, const float* b, size_t begin, size_t n) {
+    float sum = 0.0f;
+    for (size_t i = begin; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+float squared_l2_scalar(const float* a, const float* b, size_t begin, size_t n) {
+    float sum = 0.0f;
+    for (size_t i = begin; i < n; i++) {
+        const float d = a[i] - b[i];
+        sum += d * d;
+    }
+    return sum;
+}
+
+#if defined(ZVEC_DISTANCE_X86)
+
+__attribute__((target("avx2,fma")))
+float horizontal_sum(__m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+    return _mm_cvtss_f32(s);
+}
+
+__attribute__((target("avx2,fma")))
+size_t dot_avx2(const float* a, const float* b, size_t n, float* out) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), acc1);
+    }
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+    }
+    *out = horizontal_sum(_mm256_add_ps(acc0, acc1));
+    return i;
+}
+
+__attribute__((target("avx2,fma")))
+size_t squared_l2_avx2(const float* a, const float* b, size_t n, float* out) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+        __m256 d1 = _mm256_sub_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8));
+        acc0 = _mm256_fmadd_ps(d0, d0, acc0);
+        acc1 = _mm256_fmadd_ps(d1, d1, acc1);
+    }
+    for (; i + 8 <= n; i += 8) {
+        __m256 d = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+        acc0 = _mm256_fmadd_ps(d, d, acc0);
+    }
+    *out = horizontal_sum(_mm256_add_ps(acc0, acc1));
+    return i;
+}
+
+#elif defined(ZVEC_DISTANCE_NEON)
+
+size_t dot_neon(const float* a, const float* b, size_t n, float* out) {
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc0 = vfmaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+        acc1 = vfmaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+    }
+    *out = vaddvq_f32(vaddq_f32(acc0, acc1));
+    return i;
+}
+
+size_t squared_l2_neon(const float* a, const float* b, size_t n, float* out) {
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        float32x4_t d0 = vsubq_f32(vld1q_f32(a + i), vld1q_f32(b + i));
+        float32x4_t d1 = vsubq_f32(vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+        acc0 = vfmaq_f32(acc0, d0, d0);
+        acc1 = vfmaq_f32(acc1, d1, d1);
+    }
+    *out = vaddvq_f32(vaddq_f32(acc0, acc1));
+    return i;
+}
+
+#endif
+
+}
+
+namespace zvec_wrapper {
+
+float dot_fp32(const float* a, const float* b, size_t n) {
+    float sum = 0.0f;
+    size_t done = 0;
+#if defined(ZVEC_DISTANCE_X86)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    if (has_avx2) {
+        done = dot_avx2(a, b, n, &sum);
+    }
+#elif defined(ZVEC_DISTANCE_NEON)
+    done = dot_neon(a, b, n, &sum);
+#endif
+    return sum + dot_scalar(a, b, done, n);
+}
+
+float squared_l2_fp32(const float* a, const float* b, size_t n) {
+    float sum = 0.0f;
+    size_t done = 0;
+#if defined(ZVEC_DISTANCE_X86)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    if (has_avx2) {
+        done = squared_l2_avx2(a, b, n, &sum);
+    }
+#elif defined(ZVEC_DISTANCE_NEON)
+    done = squared_l2_neon(a, b, n, &sum);
+#endif
+    return sum + squared_l2_scalar(a, b, done, n);
+}
+
+}
@@ -1,4 +1,5 @@
 #include "zvec_c_internal.h"
+#include <cmath>
 #include <cstring>
 
 namespace {
@@ -15,26 +16,108 @@ zvec_status_t set_field_helper(zvec::Doc* doc, const char* field, T value) {
     return zvec_wrapper::ok_status();
 }
 
+// The doc for writing; drops vector views that may go stale. A doc still
+// shared with a result list or the result cache is copied first.
+zvec::Doc* fields_for_write(zvec_doc_t* doc) {
+    doc->vector_views.clear();
+    if (doc->ptr.use_count() > 1) {
+        doc->ptr = std::make_shared<zvec::Doc>(*doc->ptr);
+    }
+    return doc->ptr.get();
 }
 
-extern "C" {
+template<typename T>
+bool view_vector(const zvec::Doc& doc, const std::string& field, zvec_data_type_t data_type,
+                 zvec_wrapper::VectorView* out) {
+    auto value = doc.get<std::vector<T>>(field);
+    if (!value.has_value()) {
+        return false;
+    }
+    auto storage = std::make_shared<const std::vector<T>>(std::move(value.value()));
+    out->view.data = storage->data();
+    out->view.len = storage->size();
+    out->view.data_type = data_type;
+    out->storage = std::move(storage);
+    return true;
+}
 
-zvec_doc_t* zvec_doc_new(void) {
+zvec_doc_t* new_doc(bool owned) {
     auto* doc = new zvec_doc_t;
     doc->ptr = std::make_shared<zvec::Doc>();
-    doc->owned = true;
+    doc->owned = owned;
     return doc;
 }
 
+void reset_doc(zvec_doc_t* doc) {
+    // A doc still shared with a result list gets a fresh one instead.
+    if (doc->ptr && doc->ptr.use_count() == 1) {
+        *doc->ptr = zvec::Doc();
+    } else {
+        doc->ptr = std::make_shared<zvec::Doc>();
+    }
+    doc->string_cache.clear();
+    doc->vector_views.clear();
+}
+
+}
+
+extern "C" {
+
+zvec_doc_t* zvec_doc_new(void) {
+    return new_doc(true);
+}
+
 void zvec_doc_free(zvec_doc_t* doc) {
     if (doc && doc->owned) {
         delete doc;
     }
 }
 
+void zvec_doc_reset(zvec_doc_t* doc) {
+    if (doc) {
+        reset_doc(doc);
+    }
+}
+
+zvec_doc_arena_t* zvec_doc_arena_new(size_t capacity) {
+    auto* arena = new zvec_doc_arena_t;
+    arena->docs.reserve(capacity);
+    for (size_t i = 0; i < capacity; i++) {
+        arena->docs.push_back(new_doc(false));
+    }
+    return arena;
+}
+
+zvec_doc_t* zvec_doc_arena_acquire(zvec_doc_arena_t* arena) {
+    if (!arena) {
+        return nullptr;
+    }
+    if (arena->next == arena->docs.size()) {
+        arena->docs.push_back(new_doc(false));
+    } else {
+        reset_doc(arena->docs[arena->next]);
+    }
+    return arena->docs[arena->next++];
+}
+
+void zvec_doc_arena_reset(zvec_doc_arena_t* arena) {
+    if (arena) {
+        arena->next = 0;
+    }
+}
+
+void zvec_doc_arena_free(zvec_doc_arena_t* arena) {
+    if (arena) {
+        for (auto* doc : arena->docs) {
+            delete doc;
+        }
+        delete arena;
+    }
+}
+
 void zvec_doc_set_pk(zvec_doc_t* doc, const char* pk) {
     if (doc && doc->ptr && pk) {
-        doc->ptr->set_pk(std::string(pk));
+        fields_for_write(doc)->set_pk(std::string(pk));
     }
 }
 
@@ -48,7 +131,7 @@ const char* zvec_doc_pk(const zvec_doc_t* doc) {
 
 void zvec_doc_set_score(zvec_doc_t* doc, float score) {
     if (doc && doc->ptr) {
-        doc->ptr->set_score(score);
+        fields_for_write(doc)->set_score(score);
     }
 }
 
@@ -61,7 +144,7 @@ float zvec_doc_score(const zvec_doc_t* doc) {
 
 void zvec_doc_set_doc_id(zvec_doc_t* doc, uint64_t doc_id) {
     if (doc && doc->ptr) {
-        doc->ptr->set_doc_id(doc_id);
+        fields_for_write(doc)->set_doc_id(doc_id);
     }
 }
 
@@ -73,31 +156,31 @@ uint64_t zvec_doc_doc_id(const zvec_doc_t* doc) {
 }
 
 zvec_status_t zvec_doc_set_bool(zvec_doc_t* doc, const char* field, bool value) {
-    return set_field_helper(doc->ptr.get(), field, value);
+    return set_field_helper(fields_for_write(doc), field, value);
 }
 
 zvec_status_t zvec_doc_set_int32(zvec_doc_t* doc, const char* field, int32_t value) {
-    return set_field_helper(doc->ptr.get(), field, value);
+    return set_field_helper(fields_for_write(doc), field, value);
 }
 
 zvec_status_t zvec_doc_set_int64(zvec_doc_t* doc, const char* field, int64_t value) {
-    return set_field_helper(doc->ptr.get(), field, value);
+    return set_field_helper(fields_for_write(doc), field, value);
 }
 
 zvec_status_t zvec_doc_set_uint32(zvec_doc_t* doc, const char* field, uint32_t value) {
-    return set_field_helper(doc->ptr.get(), field, value);
+    return set_field_helper(fields_for_write(doc), field, value);
 }
 
 zvec_status_t zvec_doc_set_uint64(zvec_doc_t* doc, const char* field, uint64_t value) {
-    return set_field_helper(doc->ptr.get(), field, value);
+    return set_field_helper(fields_for_write(doc), field, value);
 }
 
 zvec_status_t zvec_doc_set_float(zvec_doc_t* doc, const char* field, float value) {
-    return set_field_helper(doc->ptr.get(), field, value);
+    return set_field_helper(fields_for_write(doc), field, value);
 }
 
 zvec_status_t zvec_doc_set_double(zvec_doc_t* doc, const char* field, double value) {
-    return set_field_helper(doc->ptr.get(), field, value);
+    return set_field_helper(fields_for_write(doc), field, value);
 }
 
 zvec_status_t zvec_doc_set_string(zvec_doc_t* doc, const char* field, const char* value) {
@@ -107,13 +190,13 @@ zvec_status_t zvec_doc_set_string(zvec_doc_t* doc, const char* field, const char
         s.message = strdup("Invalid doc or field");
         return s;
     }
-    doc->ptr->set<std::string>(std::string(field), std::string(value));
+    fields_for_write(doc)->set<std::string>(std::string(field), std::string(value));
     return zvec_wrapper::ok_status();
 }
 
 void zvec_doc_set_null(zvec_doc_t* doc, const char* field) {
     if (doc && doc->ptr && field) {
-        doc->ptr->set_null(std::string(field));
+        fields_for_write(doc)->set_null(std::string(field));
     }
 }
 
@@ -125,7 +208,7 @@ zvec_status_t zvec_doc_set_vector_fp32(zvec_doc_t* doc, const char* field, const
         return s;
     }
     std::vector<float> vec(data, data + len);
-    doc->ptr->set(std::string(field), std::move(vec));
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
     return zvec_wrapper::ok_status();
 }
 
@@ -137,7 +220,7 @@ zvec_status_t zvec_doc_set_vector_fp64(zvec_doc_t* doc, const char* field, const
         return s;
     }
     std::vector<double> vec(data, data + len);
-    doc->ptr->set(std::string(field), std::move(vec));
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
     return zvec_wrapper::ok_status();
 }
 
@@ -149,7 +232,7 @@ zvec_status_t zvec_doc_set_vector_int8(zvec_doc_t* doc, const char* field, const
         return s;
     }
     std::vector<int8_t> vec(data, data + len);
-    doc->ptr->set(std::string(field), std::move(vec));
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
     return zvec_wrapper::ok_status();
 }
 
@@ -161,7 +244,7 @@ zvec_status_t zvec_doc_set_vector_int16(zvec_doc_t* doc, const char* field, cons
         return s;
     }
     std::vector<int16_t> vec(data, data + len);
-    doc->ptr->set(std::string(field), std::move(vec));
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
     return zvec_wrapper::ok_status();
 }
 
@@ -173,7 +256,7 @@ zvec_status_t zvec_doc_set_vector_int32(zvec_doc_t* doc, const char* field, cons
         return s;
     }
     std::vector<int32_t> vec(data, data + len);
-    doc->ptr->set(std::string(field), std::move(vec));
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
     return zvec_wrapper::ok_status();
 }
 
@@ -185,7 +268,47 @@ zvec_status_t zvec_doc_set_vector_int64(zvec_doc_t* doc, const char* field, cons
         return s;
     }
     std::vector<int64_t> vec(data, data + len);
-    doc->ptr->set(std::string(field), std::move(vec));
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
+    return zvec_wrapper::ok_status();
+}
+
+zvec_status_t zvec_doc_set_vector_fp16_from_fp32(zvec_doc_t* doc, const char* field, const float* data, size_t len) {
+    if (!doc || !doc->ptr || !field || !data) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    static_assert(sizeof(zvec::float16_t) == sizeof(uint16_t), "float16_t must be 16 bits");
+    std::vector<zvec::float16_t> vec(len);
+    zvec_wrapper::fp32_to_fp16(data, reinterpret_cast<uint16_t*>(vec.data()), len);
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
+    return zvec_wrapper::ok_status();
+}
+
+zvec_status_t zvec_doc_set_vector_int8_from_fp32(zvec_doc_t* doc, const char* field, const float* data, size_t len, float scale) {
+    if (!doc || !doc->ptr || !field || !data || !(scale > 0.0f) || std::isinf(scale)) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    std::vector<int8_t> vec(len);
+    zvec_wrapper::fp32_to_int8(data, vec.data(), len, scale);
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
+    return zvec_wrapper::ok_status();
+}
+
+zvec_status_t zvec_doc_set_vector_int4_from_fp32(zvec_doc_t* doc, const char* field, const float* data, size_t len, float scale) {
+    if (!doc || !doc->ptr || !field || !data || !(scale > 0.0f) || std::isinf(scale)) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    std::vector<int8_t> vec((len + 1) / 2);
+    zvec_wrapper::fp32_to_int4(data, vec.data(), len, scale);
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
     return zvec_wrapper::ok_status();
 }
 
@@ -199,7 +322,7 @@ zvec_status_t zvec_doc_set_sparse_vector_fp32(zvec_doc_t* doc, const char* field
     }
     std::vector<uint32_t> idx(indices, indices + indices_count);
     std::vector<float> vals(values, values + values_count);
-    doc->ptr->set(std::string(field), std::make_pair(std::move(idx), std::move(vals)));
+    fields_for_write(doc)->set(std::string(field), std::make_pair(std::move(idx), std::move(vals)));
     return zvec_wrapper::ok_status();
 }
 
@@ -211,7 +334,7 @@ zvec_status_t zvec_doc_set_array_int32(zvec_doc_t* doc, const char* field, const
         return s;
     }
     std::vector<int32_t> vec(data, data + len);
-    doc->ptr->set(std::string(field), std::move(vec));
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
     return zvec_wrapper::ok_status();
 }
 
@@ -223,7 +346,7 @@ zvec_status_t zvec_doc_set_array_int64(zvec_doc_t* doc, const char* field, const
         return s;
     }
     std::vector<int64_t> vec(data, data + len);
-    doc->ptr->set(std::string(field), std::move(vec));
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
     return zvec_wrapper::ok_status();
 }
 
@@ -235,7 +358,7 @@ zvec_status_t zvec_doc_set_array_float(zvec_doc_t* doc, const char* field, const
         return s;
     }
     std::vector<float> vec(data, data + len);
-    doc->ptr->set(std::string(field), std::move(vec));
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
     return zvec_wrapper::ok_status();
 }
 
@@ -247,7 +370,7 @@ zvec_status_t zvec_doc_set_array_double(zvec_doc_t* doc, const char* field, cons
         return s;
     }
     std::vector<double> vec(data, data + len);
-    doc->ptr->set(std::string(field), std::move(vec));
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
     return zvec_wrapper::ok_status();
 }
 
@@ -263,7 +386,7 @@ zvec_status_t zvec_doc_set_array_string(zvec_doc_t* doc, const char* field, cons
     for (size_t i = 0; i < len; i++) {
         vec.emplace_back(data[i]);
     }
-    doc->ptr->set(std::string(field), std::move(vec));
+    fields_for_write(doc)->set(std::string(field), std::move(vec));
     return zvec_wrapper::ok_status();
 }
 
@@ -347,6 +470,28 @@ size_t zvec_doc_get_vector_fp32(const zvec_doc_t* doc, const char* field, float*
     return 0;
 }
 
+bool zvec_doc_get_vector_view(const zvec_doc_t* doc, const char* field, zvec_vector_view_t* out_view) {
+    if (!doc || !doc->ptr || !field || !out_view) {
+        return false;
+    }
+    const std::string name(field);
+    auto it = doc->vector_views.find(name);
+    if (it == doc->vector_views.end()) {
+        zvec_wrapper::VectorView view;
+        const auto& fields = *doc->ptr;
+        if (!view_vector<float>(fields, name, ZVEC_DATA_TYPE_VECTOR_FP32, &view) &&
+            !view_vector<zvec::float16_t>(fields, name, ZVEC_DATA_TYPE_VECTOR_FP16, &view) &&
+            !view_vector<double>(fields, name, ZVEC_DATA_TYPE_VECTOR_FP64, &view) &&
+            !view_vector<int8_t>(fields, name, ZVEC_DATA_TYPE_VECTOR_INT8, &view) &&
+            !view_vector<int16_t>(fields, name, ZVEC_DATA_TYPE_VECTOR_INT16, &view)) {
+            return false;
+        }
+        it = doc->vector_views.emplace(name, std::move(view)).first;
+    }
+    *out_view = it->second.view;
+    return true;
+}
+
 bool zvec_doc_has(const zvec_doc_t* doc, const char* field) {
     return doc && doc->ptr && field && doc->ptr->has(std::string(field));
 }
@@ -375,10 +520,8 @@ zvec_string_array_t zvec_doc_field_names(const zvec_doc_t* doc) {
 void zvec_doc_list_free(zvec_doc_list_t* list) {
     if (list) {
         for (size_t i = 0; i < list->count; i++) {
-            if (list->docs[i]) {
-                list->docs[i]->owned = false;
-                zvec_doc_free(list->docs[i]);
-            }
+            // List handles belong to the list whatever their `owned` flag.
+            delete list->docs[i];
         }
         free(list->docs);
         list->docs = nullptr;
@@ -397,14 +540,39 @@ void zvec_write_results_free(zvec_write_results_t* results) {
     }
 }
 
+void zvec_write_summary_free(zvec_write_summary_t* summary) {
+    if (summary) {
+        free(summary->failed_bitmap);
+        free(summary->failed_indices);
+        free(summary->failed_codes);
+        for (auto& message : summary->messages) {
+            free(message);
+        }
+        memset(summary, 0, sizeof(*summary));
+    }
+}
+
+void zvec_flat_results_free(zvec_flat_results_t* results) {
+    if (results) {
+        free(results->pk_data);
+        free(results->pk_offsets);
+        free(results->scores);
+        free(results->doc_ids);
+        for (size_t i = 0; i < results->column_count; i++) {
+            free(results->columns[i].name);
+            free(results->columns[i].data);
+            free(results->columns[i].valid);
+        }
+        free(results->columns);
+        memset(results, 0, sizeof(*results));
+    }
+}
+
 void zvec_doc_map_free(zvec_doc_map_t* map) {
     if (map) {
         for (size_t i = 0; i < map->count; i++) {
             free(map->keys[i]);
-            if (map->docs[i]) {
-                map->docs[i]->owned = false;
-                zvec_doc_free(map->docs[i]);
-            }
+            delete map->docs[i];
         }
         free(map->keys);
         free(map->docs);
@@ -49,12 +49,14 @@ zvec_index_type_t zvec_index_params_type(const zvec_index_params_t* params) {
 zvec_query_params_t* zvec_query_params_new_hnsw(int ef_search) {
     auto* params = new zvec_query_params_t;
     params->ptr = std::make_shared<zvec::HnswQueryParams>(ef_search);
+    params->key = "hnsw:" + std::to_string(ef_search);
     return params;
 }
 
 zvec_query_params_t* zvec_query_params_new_ivf(int nprobe) {
     auto* params = new zvec_query_params_t;
     params->ptr = std::make_shared<zvec::IVFQueryParams>(nprobe);
+    params->key = "ivf:" + std::to_string(nprobe);
     return params;
 }
 
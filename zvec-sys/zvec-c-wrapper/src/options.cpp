@@ -28,6 +28,12 @@ void zvec_collection_options_set_max_buffer_size(zvec_collection_options_t* opti
     }
 }
 
+void zvec_collection_options_set_result_cache_capacity(zvec_collection_options_t* options, size_t capacity) {
+    if (options) {
+        options->result_cache_capacity = capacity;
+    }
+}
+
 zvec_create_index_options_t* zvec_create_index_options_new(void) {
     return new zvec_create_index_options_t;
 }
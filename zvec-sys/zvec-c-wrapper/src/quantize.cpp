@@ -0,0 +1,171 @@
+#include "zvec_c_internal.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ZVEC_QUANTIZE_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define ZVEC_QUANTIZE_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+// IEEE 754 binary32 -> binary16, round to nearest even.
+uint16_t float_to_half(float value) {
+    uint32_t x;
+    memcpy(&x, &value, sizeof(x));
+    const uint32_t sign = (x >> 16) & 0x8000;
+    uint32_t mant = x & 0x7fffff;
+    const int32_t exp = (x >> 23) & 0xff;
+
+    // NaNs are quieted and keep the top payload bits, as F16C and NEON
+    // convert them.
+    if (exp == 0xff) {
+        return sign | 0x7c00 | (mant ? 0x200 | (mant >> 13) : 0);
+    }
+    const int32_t e = exp - 127 + 15;
+    if (e >= 0x1f) {
+        return sign | 0x7c00;
+    }
+    if (e <= 0) {
+        if (e < -10) {
+            return sign;
+        }
+        mant |= 0x800000;
+        const uint32_t shift = 14 - e;
+        uint32_t half = mant >> shift;
+        const uint32_t rem = mant & ((1u << shift) - 1);
+        const uint32_t mid = 1u << (shift - 1);
+        if (rem > mid || (rem == mid && (half & 1))) {
+            half++;
+        }
+        return sign | half;
+    }
+    uint32_t half = (static_cast<uint32_t>(e) << 10) | (mant >> 13);
+    const uint32_t rem = mant & 0x1fff;
+    if (rem > 0x1000 || (rem == 0x1000 && (half & 1))) {
+        half++;
+    }
+    return sign | half;
+}
+
+// round(value / scale) clamped to [lo, hi]; NaN becomes lo.
+int8_t quantize(float value, float scale, float lo, float hi) {
+    return static_cast<int8_t>(std::min(hi, std::max(lo, std::nearbyint(value / scale))));
+}
+
+void fp32_to_fp16_scalar(const float* src, uint16_t* dst, size_t begin, size_t n) {
+    for (size_t i = begin; i < n; i++) {
+        const uint16_t h = float_to_half(src[i]);
+        memcpy(dst + i, &h, sizeof(h));
+    }
+}
+
+void fp32_to_int8_scalar(const float* src, int8_t* dst, size_t begin, size_t n, float scale) {
+    for (size_t i = begin; i < n; i++) {
+        dst[i] = quantize(src[i], scale, -128.0f, 127.0f);
+    }
+}
+
+#if defined(ZVEC_QUANTIZE_X86)
+
+__attribute__((target("avx,f16c")))
+size_t fp32_to_fp16_f16c(const float* src, uint16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t fp32_to_int8_avx2(const float* src, int8_t* dst, size_t n, float scale) {
+    const __m256 divisor = _mm256_set1_ps(scale);
+    const __m256 lo = _mm256_set1_ps(-128.0f);
+    const __m256 hi = _mm256_set1_ps(127.0f);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        // Clamp first so out-of-range and NaN inputs match the scalar path
+        // (max_ps returns `lo` for NaN); cvtps rounds to nearest even.
+        __m256 v = _mm256_div_ps(_mm256_loadu_ps(src + i), divisor);
+        __m256i q = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(v, lo), hi));
+        __m128i w = _mm_packs_epi32(_mm256_castsi256_si128(q), _mm256_extracti128_si256(q, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi16(w, w));
+    }
+    return i;
+}
+
+#elif defined(ZVEC_QUANTIZE_NEON)
+
+size_t fp32_to_fp16_neon(const float* src, uint16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float16x4_t h = vcvt_f16_f32(vld1q_f32(src + i));
+        vst1_u16(dst + i, vreinterpret_u16_f16(h));
+    }
+    return i;
+}
+
+size_t fp32_to_int8_neon(const float* src, int8_t* dst, size_t n, float scale) {
+    const float32x4_t divisor = vdupq_n_f32(scale);
+    const float32x4_t lo = vdupq_n_f32(-128.0f);
+    const float32x4_t hi = vdupq_n_f32(127.0f);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        // vmaxnm returns `lo` for NaN, as the scalar path does.
+        float32x4_t a = vdivq_f32(vld1q_f32(src + i), divisor);
+        float32x4_t b = vdivq_f32(vld1q_f32(src + i + 4), divisor);
+        int32x4_t qa = vcvtnq_s32_f32(vminq_f32(vmaxnmq_f32(a, lo), hi));
+        int32x4_t qb = vcvtnq_s32_f32(vminq_f32(vmaxnmq_f32(b, lo), hi));
+        int16x8_t w = vcombine_s16(vqmovn_s32(qa), vqmovn_s32(qb));
+        vst1_s8(dst + i, vqmovn_s16(w));
+    }
+    return i;
+}
+
+#endif
+
+}
+
+namespace zvec_wrapper {
+
+void fp32_to_fp16(const float* src, uint16_t* dst, size_t n) {
+    size_t done = 0;
+#if defined(ZVEC_QUANTIZE_X86)
+    static const bool has_f16c = __builtin_cpu_supports("f16c") && __builtin_cpu_supports("avx");
+    if (has_f16c) {
+        done = fp32_to_fp16_f16c(src, dst, n);
+    }
+#elif defined(ZVEC_QUANTIZE_NEON)
+    done = fp32_to_fp16_neon(src, dst, n);
+#endif
+    fp32_to_fp16_scalar(src, dst, done, n);
+}
+
+void fp32_to_int8(const float* src, int8_t* dst, size_t n, float scale) {
+    size_t done = 0;
+#if defined(ZVEC_QUANTIZE_X86)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2) {
+        done = fp32_to_int8_avx2(src, dst, n, scale);
+    }
+#elif defined(ZVEC_QUANTIZE_NEON)
+    done = fp32_to_int8_neon(src, dst, n, scale);
+#endif
+    fp32_to_int8_scalar(src, dst, done, n, scale);
+}
+
+void fp32_to_int4(const float* src, int8_t* dst, size_t n, float scale) {
+    for (size_t i = 0; i < n; i += 2) {
+        const uint8_t lo = static_cast<uint8_t>(quantize(src[i], scale, -8.0f, 7.0f)) & 0x0f;
+        const uint8_t hi = i + 1 < n
+            ? static_cast<uint8_t>(quantize(src[i + 1], scale, -8.0f, 7.0f)) & 0x0f : 0;
+        dst[i / 2] = static_cast<int8_t>(lo | (hi << 4));
+    }
+}
+
+}
@@ -49,9 +49,108 @@ void zvec_vector_query_set_output_fields(zvec_vector_query_t* query, const char*
     }
 }
 
+void zvec_vector_query_set_ids_only(zvec_vector_query_t* query, bool ids_only) {
+    if (query) {
+        if (ids_only) {
+            if (!query->before_ids_only) {
+                query->before_ids_only = zvec_vector_query_t::OutputSettings{
+                    query->query.output_fields_, query->query.include_vector_, query->query.include_doc_id_};
+            }
+            query->query.output_fields_ = std::vector<std::string>();
+            query->query.include_vector_ = false;
+            query->query.include_doc_id_ = true;
+        } else if (query->before_ids_only) {
+            query->query.output_fields_ = std::move(query->before_ids_only->output_fields);
+            query->query.include_vector_ = query->before_ids_only->include_vector;
+            query->query.include_doc_id_ = query->before_ids_only->include_doc_id;
+            query->before_ids_only.reset();
+        }
+    }
+}
+
+bool zvec_vector_query_include_vector(const zvec_vector_query_t* query) {
+    return query && query->query.include_vector_;
+}
+
+bool zvec_vector_query_include_doc_id(const zvec_vector_query_t* query) {
+    return query && query->query.include_doc_id_;
+}
+
 void zvec_vector_query_set_query_params(zvec_vector_query_t* query, zvec_query_params_t* params) {
     if (query && params && params->ptr) {
         query->query.query_params_ = params->ptr;
+        query->query_params_key = params->key;
+    }
+}
+
+const char* zvec_vector_query_field_name(const zvec_vector_query_t* query) {
+    return query ? query->query.field_name_.c_str() : nullptr;
+}
+
+void zvec_vector_query_set_timeout_ms(zvec_vector_query_t* query, uint64_t timeout_ms) {
+    if (query) {
+        query->timeout_ms = timeout_ms;
+    }
+}
+
+void zvec_vector_query_set_cancel_token(zvec_vector_query_t* query, const zvec_cancel_token_t* token) {
+    if (query) {
+        query->cancelled = token ? token->cancelled : nullptr;
+    }
+}
+
+zvec_cancel_token_t* zvec_cancel_token_new(void) {
+    return new zvec_cancel_token_t;
+}
+
+void zvec_cancel_token_cancel(zvec_cancel_token_t* token) {
+    if (token) {
+        token->cancelled->store(true);
+    }
+}
+
+bool zvec_cancel_token_is_cancelled(const zvec_cancel_token_t* token) {
+    return token && token->cancelled->load();
+}
+
+void zvec_cancel_token_free(zvec_cancel_token_t* token) {
+    delete token;
+}
+
+zvec_status_t zvec_vector_query_set_by_pk(zvec_vector_query_t* query, const char* pk) {
+    if (!query || !pk) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Invalid arguments");
+        return s;
+    }
+    query->by_source = true;
+    query->source_pk = pk;
+    return zvec_wrapper::ok_status();
+}
+
+void zvec_vector_query_set_exclude_source(zvec_vector_query_t* query, bool exclude) {
+    if (query) {
+        query->exclude_source = exclude;
+    }
+}
+
+zvec_status_t zvec_vector_query_set_range(zvec_vector_query_t* query, float radius, size_t max_results) {
+    if (!query || max_results == 0) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Range search requires a positive max_results");
+        return s;
+    }
+    query->ranged = true;
+    query->radius = radius;
+    query->max_results = max_results;
+    return zvec_wrapper::ok_status();
+}
+
+void zvec_vector_query_set_rerank(zvec_vector_query_t* query, uint32_t factor) {
+    if (query) {
+        query->rerank_factor = factor;
     }
 }
 
@@ -62,10 +161,22 @@ zvec_status_t zvec_vector_query_set_vector_fp32(zvec_vector_query_t* query, cons
         s.message = strdup("Invalid arguments");
         return s;
     }
-    std::string buf;
-    buf.resize(len * sizeof(float));
-    std::memcpy(&buf[0], data, len * sizeof(float));
-    query->query.query_vector_ = std::move(buf);
+    query->query.query_vector_.assign(reinterpret_cast<const char*>(data), len * sizeof(float));
+    query->by_source = false;
+    return zvec_wrapper::ok_status();
+}
+
+zvec_status_t zvec_vector_query_update_vector_fp32(zvec_vector_query_t* query, const float* data, size_t len) {
+    if (!query || !data || query->prepared_dimension == 0 || len != query->prepared_dimension) {
+        zvec_status_t s;
+        s.code = ZVEC_STATUS_INVALID_ARGUMENT;
+        s.message = strdup("Vector length does not match the prepared query");
+        return s;
+    }
+    // A no-op unless the vector was replaced through the regular setter.
+    query->query.query_vector_.resize(len * sizeof(float));
+    std::memcpy(&query->query.query_vector_[0], data, len * sizeof(float));
+    query->by_source = false;
     return zvec_wrapper::ok_status();
 }
 
@@ -86,6 +197,7 @@ zvec_status_t zvec_vector_query_set_sparse_vector_fp32(zvec_vector_query_t* quer
     val_buf.resize(values_count * sizeof(float));
     std::memcpy(&val_buf[0], values, values_count * sizeof(float));
     query->query.query_sparse_values_ = std::move(val_buf);
+    query->by_source = false;
     
     return zvec_wrapper::ok_status();
 }
@@ -154,14 +266,13 @@ zvec_status_t zvec_group_by_vector_query_set_vector_fp32(zvec_group_by_vector_qu
 void zvec_group_results_free(zvec_group_results_t* results) {
     if (results) {
         for (size_t i = 0; i < results->count; i++) {
-            if (results->groups[i].group_by_value) {
-                free(results->groups[i].group_by_value);
-            }
             zvec_doc_list_free(&results->groups[i].docs);
         }
         free(results->groups);
+        delete static_cast<zvec_wrapper::GroupResultsPtr*>(results->owner);
         results->groups = nullptr;
         results->count = 0;
+        results->owner = nullptr;
     }
 }
 